@@ -0,0 +1,37 @@
+// js/account.js - Hesap ayarları sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { secureFetch, showMessage } = App;
+
+    // Hesap Ayarları
+    function initAccountPage() {
+        const form = document.getElementById('accountForm');
+        if (!form) return;
+
+        secureFetch('/api/settings').then(r => r && r.json()).then(settings => {
+            if (settings) {
+                form.querySelector('#deviceName').value = settings.deviceName || '';
+                form.querySelector('#tmName').value = settings.tmName || '';
+                form.querySelector('#username').value = settings.username || '';
+            }
+        }).catch(error => {
+            console.error('Ayarlar yüklenemedi:', error);
+            showMessage('Ayarlar yüklenemedi', 'error');
+        });
+
+        form.addEventListener('submit', async (e) => {
+            e.preventDefault();
+            try {
+                const response = await secureFetch('/api/settings', {
+                    method: 'POST',
+                    body: new URLSearchParams(new FormData(form))
+                });
+                showMessage(response && response.ok ? 'Ayarlar başarıyla kaydedildi.' : 'Ayarlar kaydedilirken bir hata oluştu.', response && response.ok ? 'success' : 'error');
+            } catch (error) {
+                console.error('Ayar kayıt hatası:', error);
+                showMessage('Bir hata oluştu', 'error');
+            }
+        });
+    }
+
+    App.registerPage('account', initAccountPage);
+})(window.App);
@@ -0,0 +1,73 @@
+// js/backup.js - Yedekleme sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { secureFetch, showMessage } = App;
+
+// Yedekleme Sayfası
+function initBackupPage() {
+    // Download butonu için event listener ekle
+    const downloadBtn = document.getElementById('downloadBackupBtn');
+    if (downloadBtn) {
+        downloadBtn.addEventListener('click', downloadBackup);
+    }
+    
+    // Upload form event listener
+    document.getElementById('uploadBackupForm')?.addEventListener('submit', async (e) => {
+        e.preventDefault();
+        const fileInput = document.getElementById('backupFile');
+        if (fileInput.files.length === 0) {
+            showMessage('Lütfen bir yedek dosyası seçin.', 'warning');
+            return;
+        }
+        const formData = new FormData();
+        formData.append('backup', fileInput.files[0]);
+        
+        showMessage('Yedek yükleniyor, lütfen bekleyin. Cihaz işlem sonrası yeniden başlatılacak.', 'info');
+
+        try {
+            const response = await secureFetch('/api/backup/upload', {
+                method: 'POST',
+                body: formData
+            });
+
+            if(response && response.ok){
+                showMessage('Yedek başarıyla yüklendi! Cihaz 3 saniye içinde yeniden başlatılıyor...', 'success');
+                setTimeout(() => window.location.href = '/', 3000);
+            } else {
+                showMessage('Yedek yükleme başarısız oldu. Dosyanın geçerli olduğundan emin olun.', 'error');
+            }
+        } catch (error) {
+            console.error('Backup yükleme hatası:', error);
+            showMessage('Bir hata oluştu', 'error');
+        }
+    });
+}
+
+// Yedek indirme fonksiyonu (global olarak tanımlanmalı - window nesnesine ekle)
+window.downloadBackup = async function downloadBackup() {
+    try {
+        const response = await secureFetch('/api/backup/download');
+        
+        if (response && response.ok) {
+            // Blob olarak indirme
+            const blob = await response.blob();
+            const url = window.URL.createObjectURL(blob);
+            const a = document.createElement('a');
+            a.href = url;
+            a.download = `teias_eklim_backup_${new Date().toISOString().slice(0, 10)}.json`;
+            document.body.appendChild(a);
+            a.click();
+            document.body.removeChild(a);
+            window.URL.revokeObjectURL(url);
+            
+            showMessage('Yedek dosyası indiriliyor...', 'success');
+        } else {
+            showMessage('Yedek indirme yetkisi yok veya bir hata oluştu', 'error');
+        }
+    } catch (error) {
+        console.error('Backup indirme hatası:', error);
+        showMessage('Yedek indirilirken bir hata oluştu', 'error');
+    }
+}
+
+    App.registerPage('backup', initBackupPage);
+})(window.App);
@@ -0,0 +1,36 @@
+// js/baudrate.js - BaudRate ayarları sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { secureFetch, showMessage, updateElement } = App;
+
+    // BaudRate Ayarları (Test butonu kaldırıldı)
+    function initBaudRatePage() { 
+        const form = document.getElementById('baudrateForm');
+        if (!form) return;
+
+        secureFetch('/api/baudrate').then(r => r && r.json()).then(br => {
+            if (br) {
+                updateElement('currentBaudRate', br.baudRate + ' bps');
+                const radio = document.querySelector(`input[name="baud"][value="${br.baudRate}"]`);
+                if (radio) radio.checked = true;
+            }
+        }).catch(error => {
+            console.error('Baudrate yüklenemedi:', error);
+            showMessage('Baudrate bilgisi alınamadı', 'error');
+        });
+        
+        form.addEventListener('submit', async (e) => {
+            e.preventDefault();
+            const formData = new FormData(form);
+            try {
+                const response = await secureFetch('/api/baudrate', { method: 'POST', body: new URLSearchParams(formData) });
+                showMessage(response && response.ok ? 'BaudRate başarıyla değiştirildi.' : 'BaudRate değiştirilemedi.', response && response.ok ? 'success' : 'error');
+                if(response && response.ok) updateElement('currentBaudRate', formData.get('baud') + ' bps');
+            } catch (error) {
+                console.error('Baudrate değiştirme hatası:', error);
+                showMessage('Bir hata oluştu', 'error');
+            }
+        });
+    }
+
+    App.registerPage('baudrate', initBaudRatePage);
+})(window.App);
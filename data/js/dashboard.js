@@ -0,0 +1,52 @@
+// js/dashboard.js - Gösterge paneli sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { state, secureFetch, showMessage, updateElement, serverEvents, onServerEvent } = App;
+
+    // Gösterge Paneli
+    function initDashboardPage() {
+        console.log("Gösterge paneli başlatılıyor...");
+        const updateStatus = () => {
+            secureFetch('/api/status')
+                .then(response => response && response.json())
+                .then(data => data && updateDashboardUI(data))
+                .catch(error => {
+                    console.error('Durum verileri alınamadı:', error);
+                    showMessage('Durum verileri alınamadı', 'error');
+                });
+        };
+        if (serverEvents.connected && serverEvents.snapshot.status.datetime) {
+            updateDashboardUI(serverEvents.snapshot.status);
+        } else {
+            updateStatus();
+        }
+        onServerEvent('status', () => updateDashboardUI(serverEvents.snapshot.status));
+        // Olay akışı açıkken istek atılmaz; akış koparsa 5 sn'lik sorgu devreye girer
+        state.pollingIntervals.status = setInterval(() => {
+            if (!serverEvents.connected) updateStatus();
+        }, 5000);
+    }
+
+    function updateDashboardUI(data) {
+        updateElement('currentDateTime', data.datetime);
+        const ethStatusEl = document.getElementById('ethernetStatus');
+        if(ethStatusEl) ethStatusEl.innerHTML = `<span class="status-indicator ${data.ethernetStatus ? 'active' : 'error'}"></span> ${data.ethernetStatus ? 'Bağlı' : 'Yok'}`;
+        const timeStatusEl = document.getElementById('ntpStatus');
+        if(timeStatusEl) timeStatusEl.innerHTML = `<span class="status-indicator ${data.timeSynced ? 'active' : 'warning'}"></span> ${data.timeSynced ? 'Senkronize' : 'Bekleniyor'}`;
+        
+        updateElement('deviceName', data.deviceName);
+        updateElement('tmName', data.tmName);
+        updateElement('deviceIP', data.deviceIP);
+        updateElement('uptime', data.uptime);
+        
+        const memoryUsage = document.getElementById('memoryUsage');
+        if(memoryUsage && data.freeHeap && data.totalHeap) {
+            const usagePercent = Math.round(((data.totalHeap - data.freeHeap) / data.totalHeap) * 100);
+            const progressBar = memoryUsage.querySelector('.progress-fill');
+            const percentText = memoryUsage.querySelector('span:last-child');
+            if(progressBar) progressBar.style.width = `${usagePercent}%`;
+            if(percentText) percentText.textContent = `${usagePercent}%`;
+        }
+    }
+
+    App.registerPage('dashboard', initDashboardPage);
+})(window.App);
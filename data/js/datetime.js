@@ -0,0 +1,417 @@
+// js/datetime.js - dsPIC tarih/saat sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { state, secureFetch, showMessage, updateElement } = App;
+
+// DateTime sayfası başlatma fonksiyonu
+function initDateTimePage() {
+    console.log('🕒 DateTime sayfası başlatılıyor...');
+    
+    // Sayfa elementleri
+    const getDateTimeBtn = document.getElementById('getDateTimeBtn');
+    const refreshDateTimeBtn = document.getElementById('refreshDateTimeBtn');
+    const datetimeForm = document.getElementById('datetimeForm');
+    const previewBtn = document.getElementById('previewBtn');
+    const setCurrentBtn = document.getElementById('setCurrentBtn');
+    const syncWithESP32Btn = document.getElementById('syncWithESP32Btn');
+    const resetFormBtn = document.getElementById('resetFormBtn');
+    
+    if (!getDateTimeBtn) {
+        console.error('DateTime sayfa elementleri bulunamadı');
+        return;
+    }
+    
+    // İlk yüklemede datetime bilgisini çek
+    loadDateTimeStatus();
+    
+    // Event listener'ları ekle
+    getDateTimeBtn.addEventListener('click', fetchDateTimeFromDsPIC);
+    refreshDateTimeBtn.addEventListener('click', loadDateTimeStatus);
+    datetimeForm.addEventListener('submit', handleSetDateTime);
+    previewBtn.addEventListener('click', showCommandPreview);
+    setCurrentBtn.addEventListener('click', setCurrentDateTime);
+    syncWithESP32Btn.addEventListener('click', syncWithESP32);
+    resetFormBtn.addEventListener('click', resetDateTimeForm);
+    
+    // Input değişikliklerini dinle (önizleme için)
+    const manualDate = document.getElementById('manualDate');
+    const manualTime = document.getElementById('manualTime');
+    
+    if (manualDate && manualTime) {
+        manualDate.addEventListener('change', updatePreviewIfVisible);
+        manualTime.addEventListener('change', updatePreviewIfVisible);
+    }
+    
+    // Komut geçmişini yükle
+    loadCommandHistory();
+    
+    console.log('✅ DateTime sayfası hazır');
+}
+
+// DateTime durumunu yükle
+async function loadDateTimeStatus() {
+    try {
+        console.log('📡 DateTime durumu yükleniyor...');
+        
+        const response = await secureFetch('/api/datetime');
+        if (response && response.ok) {
+            const data = await response.json();
+            
+            // UI'ı güncelle
+            updateElement('currentDate', data.date || '--/--/--');
+            updateElement('currentTime', data.time || '--:--:--');
+            updateElement('lastUpdate', data.lastUpdate || 'Henüz çekilmedi');
+            updateElement('rawData', data.rawData || 'Bekleniyor...');
+            
+            console.log('✅ DateTime durumu yüklendi:', data);
+        } else {
+            console.error('❌ DateTime durumu yüklenemedi');
+            showMessage('DateTime durumu yüklenemedi', 'error');
+        }
+    } catch (error) {
+        console.error('DateTime durumu yükleme hatası:', error);
+        showMessage('DateTime durumu yüklenirken hata oluştu', 'error');
+    }
+}
+
+// dsPIC'ten datetime bilgisi çek
+async function fetchDateTimeFromDsPIC() {
+    const getBtn = document.getElementById('getDateTimeBtn');
+    const btnText = getBtn.querySelector('.btn-text');
+    const btnIcon = getBtn.querySelector('.btn-icon');
+    
+    // Loading state
+    getBtn.disabled = true;
+    btnIcon.textContent = '⏳';
+    btnText.textContent = 'Çekiliyor...';
+    
+    try {
+        console.log('📡 dsPIC\'ten datetime çekiliyor...');
+        
+        const response = await secureFetch('/api/datetime/fetch', {
+            method: 'POST'
+        });
+        
+        if (response && response.ok) {
+            const data = await response.json();
+            
+            if (data.success) {
+                // UI'ı güncelle
+                updateElement('currentDate', data.date);
+                updateElement('currentTime', data.time);
+                // Önbellekten gelen değerin yaşı (saniye)
+                updateElement('lastUpdate', data.age > 0 ? `${data.age} saniye önce` : 'Az önce');
+                updateElement('rawData', data.rawData);
+                
+                showMessage('✅ Tarih-saat bilgisi başarıyla güncellendi', 'success');
+                console.log('✅ DateTime çekildi:', data);
+                
+                // Komut geçmişini güncelle
+                setTimeout(() => loadCommandHistory(), 500);
+            } else {
+                showMessage('❌ ' + (data.message || 'Tarih-saat bilgisi alınamadı'), 'error');
+                console.error('DateTime fetch başarısız:', data);
+            }
+        } else {
+            showMessage('❌ Sunucu hatası', 'error');
+        }
+    } catch (error) {
+        console.error('DateTime fetch hatası:', error);
+        showMessage('❌ DateTime bilgisi çekilirken hata oluştu', 'error');
+    } finally {
+        // Reset loading state
+        getBtn.disabled = false;
+        btnIcon.textContent = '📥';
+        btnText.textContent = 'Sistem Saatini Çek';
+    }
+}
+
+
+// DateTime ayarlama formu
+async function handleSetDateTime(e) {
+    e.preventDefault();
+    
+    const formData = new FormData(e.target);
+    const manualDate = formData.get('manualDate');
+    const manualTime = formData.get('manualTime');
+    
+    if (!manualDate || !manualTime) {
+        showMessage('❌ Tarih ve saat alanları doldurulmalıdır', 'error');
+        return;
+    }
+    
+    const setBtn = document.getElementById('setDateTimeBtn');
+    const btnText = setBtn.querySelector('.btn-text');
+    const btnLoader = setBtn.querySelector('.btn-loader');
+    
+    // Loading state
+    setBtn.disabled = true;
+    btnText.style.display = 'none';
+    btnLoader.style.display = 'inline-block';
+    
+    try {
+        console.log('📤 DateTime ayarlanıyor:', manualDate, manualTime);
+        
+        // FormData'yı URLSearchParams'a dönüştür ve Content-Type header'ı ekle
+        const params = new URLSearchParams();
+        params.append('manualDate', manualDate);
+        params.append('manualTime', manualTime);
+        
+        const response = await secureFetch('/api/datetime/set', {
+            method: 'POST',
+            headers: {
+                'Content-Type': 'application/x-www-form-urlencoded'
+            },
+            body: params.toString()
+        });
+        
+        if (response && response.ok) {
+            const data = await response.json();
+            
+            if (data.success) {
+                showMessage('✅ Tarih-saat başarıyla ayarlandı', 'success');
+                console.log('✅ DateTime ayarlandı:', data);
+                
+                // Formu temizle ve durumu güncelle
+                resetDateTimeForm();
+                setTimeout(() => {
+                    loadDateTimeStatus();
+                    loadCommandHistory();
+                }, 1000);
+            } else {
+                showMessage('❌ ' + (data.message || 'Tarih-saat ayarlanamadı'), 'error');
+                console.error('DateTime set başarısız:', data);
+            }
+        } else {
+            // Hata detayını almaya çalış
+            const errorText = await response.text();
+            console.error('Sunucu hatası detayı:', errorText);
+            showMessage('❌ Sunucu hatası: ' + (errorText || 'Bilinmeyen hata'), 'error');
+        }
+    } catch (error) {
+        console.error('DateTime set hatası:', error);
+        showMessage('❌ Tarih-saat ayarlanırken hata oluştu', 'error');
+    } finally {
+        // Reset loading state
+        setBtn.disabled = false;
+        btnText.style.display = 'inline';
+        btnLoader.style.display = 'none';
+    }
+}
+
+// Komut önizlemesi göster
+async function showCommandPreview() {
+    const manualDate = document.getElementById('manualDate').value;
+    const manualTime = document.getElementById('manualTime').value;
+    const previewSection = document.getElementById('previewSection');
+    
+    if (!manualDate || !manualTime) {
+        showMessage('❌ Önizleme için tarih ve saat alanları doldurulmalıdır', 'warning');
+        return;
+    }
+    
+    try {
+        const formData = new URLSearchParams();
+        formData.append('previewDate', manualDate);
+        formData.append('previewTime', manualTime);
+        
+        const response = await secureFetch('/api/datetime/preview', {
+            method: 'POST',
+            body: formData
+        });
+        
+        if (response && response.ok) {
+            const data = await response.json();
+            
+            if (data.valid) {
+                // Komut önizlemesini göster
+                updateElement('timeCommand', data.timeCommand);
+                updateElement('dateCommand', data.dateCommand);
+                
+                previewSection.style.display = 'block';
+                previewSection.scrollIntoView({ behavior: 'smooth' });
+                
+                showMessage('✅ Komut önizlemesi güncellendi', 'success');
+            } else {
+                showMessage('❌ ' + (data.error || 'Geçersiz tarih-saat'), 'error');
+                previewSection.style.display = 'none';
+            }
+        } else {
+            showMessage('❌ Önizleme oluşturulamadı', 'error');
+        }
+    } catch (error) {
+        console.error('Preview hatası:', error);
+        showMessage('❌ Önizleme oluşturulurken hata oluştu', 'error');
+    }
+}
+
+// Önizleme görünürse otomatik güncelle
+function updatePreviewIfVisible() {
+    const previewSection = document.getElementById('previewSection');
+    if (previewSection && previewSection.style.display !== 'none') {
+        showCommandPreview();
+    }
+}
+
+// Şimdiki zamanı ayarla (JavaScript Date kullanarak)
+async function setCurrentDateTime() {
+    const setCurrentBtn = document.getElementById('setCurrentBtn');
+    const btnText = setCurrentBtn.querySelector('.btn-text');
+    const btnIcon = setCurrentBtn.querySelector('.btn-icon');
+    
+    // Loading state
+    setCurrentBtn.disabled = true;
+    btnIcon.textContent = '⏳';
+    btnText.textContent = 'Ayarlanıyor...';
+    
+    try {
+        const now = new Date();
+        const timestamp = now.getTime(); // Milisaniye
+        
+        console.log('🕐 Şimdiki zaman ayarlanıyor:', now.toLocaleString());
+        
+        const formData = new URLSearchParams();
+        formData.append('timestamp', timestamp.toString());
+        
+        const response = await secureFetch('/api/datetime/set-current', {
+            method: 'POST',
+            body: formData
+        });
+        
+        if (response && response.ok) {
+            const data = await response.json();
+            
+            if (data.success) {
+                showMessage('✅ Şimdiki zaman başarıyla ayarlandı', 'success');
+                console.log('✅ Current time set:', data);
+                
+                setTimeout(() => {
+                    loadDateTimeStatus();
+                    loadCommandHistory();
+                }, 1000);
+            } else {
+                showMessage('❌ ' + (data.message || 'Şimdiki zaman ayarlanamadı'), 'error');
+            }
+        } else {
+            showMessage('❌ Sunucu hatası', 'error');
+        }
+    } catch (error) {
+        console.error('Set current time hatası:', error);
+        showMessage('❌ Şimdiki zaman ayarlanırken hata oluştu', 'error');
+    } finally {
+        // Reset loading state
+        setCurrentBtn.disabled = false;
+        btnIcon.textContent = '🕐';
+        btnText.textContent = 'Şimdiki Zamanı Ayarla';
+    }
+}
+
+// ESP32 saati ile senkronize et
+async function syncWithESP32() {
+    const syncBtn = document.getElementById('syncWithESP32Btn');
+    const btnText = syncBtn.querySelector('.btn-text');
+    const btnIcon = syncBtn.querySelector('.btn-icon');
+    
+    // Loading state
+    syncBtn.disabled = true;
+    btnIcon.textContent = '⏳';
+    btnText.textContent = 'Senkronize ediliyor...';
+    
+    try {
+        console.log('🔄 ESP32 saati ile senkronizasyon...');
+        
+        const response = await secureFetch('/api/datetime/sync-esp32', {
+            method: 'POST'
+        });
+        
+        if (response && response.ok) {
+            const data = await response.json();
+            
+            if (data.success) {
+                showMessage('✅ ESP32 saati ile senkronizasyon tamamlandı', 'success');
+                console.log('✅ ESP32 sync:', data);
+                
+                setTimeout(() => {
+                    loadDateTimeStatus();
+                    loadCommandHistory();
+                }, 1000);
+            } else {
+                showMessage('❌ ' + (data.message || 'Senkronizasyon başarısız'), 'error');
+            }
+        } else {
+            showMessage('❌ Sunucu hatası', 'error');
+        }
+    } catch (error) {
+        console.error('ESP32 sync hatası:', error);
+        showMessage('❌ Senkronizasyon sırasında hata oluştu', 'error');
+    } finally {
+        // Reset loading state
+        syncBtn.disabled = false;
+        btnIcon.textContent = '🔄';
+        btnText.textContent = 'ESP32 Saati ile Senkronize Et';
+    }
+}
+
+// Formu temizle
+function resetDateTimeForm() {
+    const form = document.getElementById('datetimeForm');
+    const previewSection = document.getElementById('previewSection');
+    
+    if (form) {
+        form.reset();
+    }
+    
+    if (previewSection) {
+        previewSection.style.display = 'none';
+    }
+    
+    showMessage('✅ Form temizlendi', 'info');
+}
+
+// Komut geçmişini yükle
+async function loadCommandHistory() {
+    try {
+        const response = await secureFetch('/api/datetime/history');
+        if (response && response.ok) {
+            const history = await response.json();
+            
+            const historySection = document.getElementById('historySection');
+            const commandHistory = document.getElementById('commandHistory');
+            
+            if (history.length > 0) {
+                // History section'ı göster
+                historySection.style.display = 'block';
+                
+                // History içeriğini oluştur
+                let historyHTML = '';
+                history.forEach(entry => {
+                    const statusClass = entry.success ? 'success' : 'error';
+                    const statusText = entry.success ? 'Başarılı' : 'Hata';
+                    
+                    historyHTML += `
+                        <div class="history-entry">
+                            <div class="history-command">${escapeHtml(entry.command)}</div>
+                            <div class="history-time">${escapeHtml(entry.timestamp)}</div>
+                            <div class="history-status ${statusClass}">${statusText}</div>
+                        </div>
+                    `;
+                });
+                
+                commandHistory.innerHTML = historyHTML;
+            } else {
+                historySection.style.display = 'none';
+            }
+        }
+    } catch (error) {
+        console.error('Command history yükleme hatası:', error);
+    }
+}
+
+// HTML escape helper
+function escapeHtml(text) {
+    const div = document.createElement('div');
+    div.textContent = text;
+    return div.innerHTML;
+}
+
+    App.registerPage('datetime', initDateTimePage);
+})(window.App);
@@ -0,0 +1,946 @@
+// js/fault.js - Arıza kayıtları ve canlı UART konsolu sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { state, secureFetch, showMessage, logout } = App;
+
+// Arıza Kayıtları Sayfası - Toplu Sorgulama Versiyonu
+function initFaultPage() {
+    console.log("🛠️ Arıza Kayıtları sayfası başlatılıyor (Toplu sorgulama)...");
+    
+    const fetchAllFaultsBtn = document.getElementById('fetchAllFaultsBtn');
+    const refreshFaultBtn = document.getElementById('refreshFaultBtn');
+    const exportCSVBtn = document.getElementById('exportCSVBtn');
+    const exportExcelBtn = document.getElementById('exportExcelBtn');
+    const clearFaultBtn = document.getElementById('clearFaultBtn');
+    const filterPinType = document.getElementById('filterPinType');
+    const faultTableBody = document.getElementById('faultTableBody');
+    const manualTestForm = document.getElementById('manualTestForm');
+    
+    if (!fetchAllFaultsBtn || !faultTableBody) {
+        console.error("Fault page elementleri bulunamadı!");
+        return;
+    }
+    
+    let faultRecords = [];
+    let filteredRecords = [];
+    let isLoading = false;
+    
+    // Başka sayfaya geçilince toplu sorgu durur (loadPage bu sinyali iptal eder)
+    const pageSignal = state.pageController.signal;
+    
+    // Ham arıza verisini parse et
+    function parseFaultData(rawData) {
+        console.log("Parse ediliyor:", rawData);
+        
+        const data = rawData.trim();
+        
+        // Arıza numarasını ayır
+        let recordNumber = 0;
+        let faultData = data;
+        
+        if (data.includes(':')) {
+            const parts = data.split(':');
+            recordNumber = parseInt(parts[0]);
+            faultData = parts[1];
+        }
+        
+        if (faultData.length < 22) {
+            console.error("Çok kısa veri:", faultData);
+            return null;
+        }
+        
+        try {
+            // Pin numarası - HEX olarak parse et
+            const pinHex = faultData.substring(0, 2);
+            const pinNumber = parseInt(pinHex, 16);// 16 tabanında parse et
+
+            // "0A" = 10 (decimal)
+            console.log(`Pin hex: ${pinHex} → decimal: ${pinNumber}`);
+            
+            let pinType, pinName, displayPinNumber;
+            
+            // Pin tipi belirleme - GİRİŞ pinleri 9-16 arasında
+            if (pinNumber >= 1 && pinNumber <= 8) {
+            pinType = "Çıkış";
+            pinName = "Çıkış " + pinNumber;
+            displayPinNumber = pinNumber;
+            } else if (pinNumber >= 9 && pinNumber <= 16) {
+            pinType = "Giriş";
+            // 9-16 aralığını 1-8 olarak göster
+            const adjustedPinNumber = pinNumber - 8;
+            pinName = "Giriş " + adjustedPinNumber;
+            displayPinNumber = adjustedPinNumber;
+        } else {
+        pinType = "Bilinmeyen";
+        pinName = "Pin " + pinNumber;
+        displayPinNumber = pinNumber;
+        }
+            
+            // Tarih-saat - DECIMAL olarak parse et
+            const year = 2000 + parseInt(faultData.substring(2, 4), 10);
+            const month = parseInt(faultData.substring(4, 6), 10);
+            const day = parseInt(faultData.substring(6, 8), 10);
+            const hour = parseInt(faultData.substring(8, 10), 10);
+            const minute = parseInt(faultData.substring(10, 12), 10);
+            const second = parseInt(faultData.substring(12, 14), 10);
+            
+            console.log("Tarih:", {year, month, day, hour, minute, second});
+            
+            // Tarih doğrulama
+            if (month < 1 || month > 12 || day < 1 || day > 31 || 
+                hour > 23 || minute > 59 || second > 59) {
+                console.error("Geçersiz tarih-saat!");
+                return null;
+            }
+            
+            const dateTime = `${day.toString().padStart(2, '0')}/${month.toString().padStart(2, '0')}/${year} ` +
+                            `${hour.toString().padStart(2, '0')}:${minute.toString().padStart(2, '0')}:${second.toString().padStart(2, '0')}`;
+            
+            // Milisaniye - DECIMAL olarak parse et
+            let millisecond = 0;
+            if (faultData.length >= 17) {
+                millisecond = parseInt(faultData.substring(14, 17), 10);
+                console.log(`Milisaniye: ${millisecond} ms`);
+            }
+            
+            // Süre - DECIMAL olarak parse et
+            let duration = "0.000 sn";
+            let durationSeconds = 0;
+            
+            if (faultData.length >= 22) {
+                const durationStr = faultData.substring(17, 22);
+                const seconds = parseInt(durationStr.substring(0, 2), 10);
+                const ms = parseInt(durationStr.substring(2, 5), 10);
+                durationSeconds = seconds + (ms / 1000.0);
+                
+                console.log(`Süre: ${seconds}.${ms} = ${durationSeconds} saniye`);
+                
+                if (durationSeconds < 1.0) {
+                    duration = Math.round(durationSeconds * 1000) + " ms";
+                } else if (durationSeconds < 60.0) {
+                    duration = durationSeconds.toFixed(3) + " sn";
+                } else {
+                    const mins = Math.floor(durationSeconds / 60);
+                    const secs = durationSeconds % 60;
+                    duration = mins + "dk " + secs.toFixed(1) + "sn";
+                }
+            }
+            
+            return {
+                recordNumber,
+                pinNumber: displayPinNumber, // Görüntülenecek pin numarası
+                actualPinNumber: pinNumber,  // Gerçek pin numarası (9-16)
+                pinType,
+                pinName,
+                dateTime,
+                duration,
+                durationSeconds,
+                millisecond,
+                rawData: data
+            };
+            
+        } catch (error) {
+            console.error("Parse hatası:", error);
+            return null;
+        }
+    }
+    
+    // Arıza kaydı ekleme - GÜNCELLEME
+    function addFaultToTable(fault, index, faultNo) {
+    const row = document.createElement('tr');
+    row.className = 'fault-row new-row';
+    
+    const pinBadgeClass = fault.pinType === 'Çıkış' ? 'output' : 'input';
+    const dateTimeWithMs = `${fault.dateTime}.${fault.millisecond}`;
+    
+    // Tabloda gösterilecek sıra numarası
+    // En üstteki en yeni (en büyük faultNo) olacak şekilde
+    const displayOrder = faultNo;
+    
+    row.innerHTML = `
+        <td class="text-center">${displayOrder}</td>
+        <td class="text-center"><span class="fault-number-badge">${faultNo.toString().padStart(5, '0')}</span></td>
+        <td class="text-center">${fault.pinNumber}</td>
+        <td><span class="pin-badge ${pinBadgeClass}">${fault.pinType}</span></td>
+        <td class="datetime-cell">${dateTimeWithMs}</td>
+        <td class="duration-cell">${fault.duration}</td>
+        <td class="raw-data-cell" title="${fault.rawData}">${fault.rawData}</td>
+    `;
+    
+    return row;
+    }
+    
+    // Tabloyu güncelle
+    function updateTable() {
+    const filterType = filterPinType ? filterPinType.value : 'all';
+    filteredRecords = filterType === 'all' ? 
+        [...faultRecords] : 
+        faultRecords.filter(record => record.pinType === filterType);
+    
+    faultTableBody.innerHTML = '';
+    
+    if (filteredRecords.length === 0) {
+        faultTableBody.innerHTML = `
+            <tr class="empty-row">
+                <td colspan="7" class="empty-state">
+                    <div class="empty-icon">🔍</div>
+                    <h4>Arıza kaydı bulunamadı</h4>
+                    <p>${faultRecords.length === 0 ? 
+                        'Arıza kayıtlarını görüntülemek için "Arıza Kayıtlarını İste" butonuna tıklayın.' :
+                        'Seçilen filtreye uygun arıza kaydı bulunamadı.'}</p>
+                </td>
+            </tr>
+        `;
+        return;
+    }
+    
+    // Kayıtları ekle - TERS SIRALAMA İÇİN İNDEKS DÜZELTMESİ
+    filteredRecords.forEach((record, index) => {
+        // Gerçek arıza numarasını kullan (faultNo zaten doğru)
+        const row = addFaultToTable(record, index, record.faultNo);
+        faultTableBody.appendChild(row);
+    });
+    
+    updateElement('totalFaults', faultRecords.length.toString());
+}
+    
+    // Progress bar güncelleme
+    function updateProgress(current, total) {
+        const percent = Math.round((current / total) * 100);
+        
+        updateElement('progressCurrent', current.toString());
+        updateElement('progressTotal', total.toString());
+        updateElement('progressPercent', percent + '%');
+        
+        const progressBar = document.getElementById('progressBar');
+        if (progressBar) {
+            progressBar.style.width = percent + '%';
+        }
+    }
+    
+// AN komutuyla arıza sayısını al
+async function getFaultCount() {
+    try {
+        console.log("📊 Arıza sayısı sorgulanıyor (AN komutu)...");
+        
+        const formData = new URLSearchParams();
+        formData.append('command', 'AN');
+        formData.append('priority', 'normal');
+        
+        const response = await secureFetch('/api/uart/send', {
+            method: 'POST',
+            body: formData
+        });
+        
+        if (response && response.ok) {
+            const data = await response.json();
+            
+            if (data.success && data.response) {
+                const responseText = data.response.trim();
+                console.log(`📥 Gelen yanıt: ${responseText}`);
+                
+                // "A00050" formatını kontrol et
+                if (responseText.startsWith('A') && responseText.length >= 5) {
+                    // İlk A'dan sonraki tüm sayıları al
+                    const numberStr = responseText.substring(1); // "00050"
+                    const count = parseInt(numberStr, 10); // 50
+                    const actualFaultCount = count - 1; // 49
+                    
+                    console.log(`✅ Sistem arıza sayısı: ${actualFaultCount}`);
+                    updateElement('systemFaultCount', actualFaultCount.toString());
+                    return actualFaultCount;
+                }
+            }
+        }
+        
+        console.error("❌ Arıza sayısı alınamadı");
+        return 0;
+        
+    } catch (error) {
+        console.error("Arıza sayısı sorgu hatası:", error);
+        return 0;
+    }
+}
+    
+    // Komutlar arası bekleme - sunucudaki AIMD denetleyicisinden gelir
+    let uartPaceMs = 100;
+    
+    // Tek bir arıza kaydını al
+    async function getSingleFault(faultNo) {
+        try {
+            const command = faultNo.toString().padStart(5, '0') + 'v';
+            console.log(`📥 Arıza ${faultNo} sorgulanıyor: ${command}`);
+            
+            const formData = new URLSearchParams();
+            formData.append('command', command);
+            formData.append('priority', 'normal'); // Toplu aktarım kullanıcı komutlarına yol versin
+            
+            const response = await secureFetch('/api/uart/send', {
+                method: 'POST',
+                body: formData
+            });
+            
+            if (response && response.ok) {
+                const data = await response.json();
+                
+                // Sunucunun uyarlamalı komut aralığı
+                if (typeof data.paceMs === 'number') {
+                    uartPaceMs = data.paceMs;
+                }
+                
+                if (data.success && data.response && data.response.length > 10) {
+                    const parsedFault = parseFaultData(data.response);
+                    
+                    if (parsedFault) {
+                        parsedFault.faultNo = faultNo; // Arıza numarasını ekle
+                        return parsedFault;
+                    }
+                }
+            }
+            
+            return null;
+            
+        } catch (error) {
+            console.error(`Arıza ${faultNo} alınamadı:`, error);
+            return null;
+        }
+    }
+    
+    // Tüm arızaları toplu al
+    async function fetchAllFaults() {
+        if (isLoading) return;
+        isLoading = true;
+        
+        const btnText = fetchAllFaultsBtn.querySelector('.btn-text');
+        const btnIcon = fetchAllFaultsBtn.querySelector('.btn-icon');
+        const btnLoader = fetchAllFaultsBtn.querySelector('.btn-loader');
+        const progressSection = document.getElementById('progressSection');
+        
+        // UI'ı loading durumuna al
+        fetchAllFaultsBtn.disabled = true;
+        btnIcon.style.display = 'none';
+        btnLoader.style.display = 'inline-block';
+        btnText.textContent = 'Sorgulanıyor...';
+        
+        // Kayıtları sıfırla
+        faultRecords = [];
+        updateTable();
+        
+        try {
+            // 1. Önce AN komutuyla toplam arıza sayısını al
+            updateElement('progressText', 'Arıza sayısı sorgulanıyor...');
+            progressSection.style.display = 'block';
+            
+            const totalCount = await getFaultCount();
+            
+            if (totalCount === 0) {
+                showMessage('❌ Sistemde arıza kaydı bulunamadı', 'warning');
+                progressSection.style.display = 'none';
+                return;
+            }
+            
+            showMessage(`✅ Sistemde ${totalCount} adet arıza bulundu. Kayıtlar alınıyor...`, 'info');
+            
+            // Progress bar'ı başlat
+            updateProgress(0, totalCount);
+            updateElement('progressText', `${totalCount} adet arıza kaydı alınıyor...`);
+            
+            // 2. Tüm arızaları sırayla al (1'den başlayarak)
+            let successCount = 0;
+            let failCount = 0;
+            
+            // TERSTEN BAŞLA: totalCount'tan 1'e doğru
+for (let i = totalCount; i >= 1; i--) {
+    // Kullanıcı sayfadan ayrıldıysa kalan kayıtları isteme
+    if (pageSignal.aborted) {
+        console.log('Toplu arıza sorgusu sayfa değiştiği için durduruldu');
+        return;
+    }
+    
+    // Progress güncelle (düz sayım için düzeltme)
+    const progressIndex = totalCount - i + 1;
+    updateProgress(progressIndex - 1, totalCount);
+    updateElement('progressText', `Arıza ${progressIndex}/${totalCount} alınıyor...`);
+    
+    // dsPIC'in kaldırabildiği kadar bekle (sunucu bildirir)
+    await new Promise(resolve => setTimeout(resolve, uartPaceMs));
+    
+    // Arıza kaydını al
+    const fault = await getSingleFault(i);
+    
+    if (fault) {
+        faultRecords.push(fault);
+        successCount++;
+        
+        // Her 5 kayıtta bir tabloyu güncelle (performans için)
+        if (successCount % 5 === 0 || progressIndex === totalCount) {
+            updateTable();
+        }
+        
+        console.log(`✅ Arıza ${i}: ${fault.pinName} - ${fault.dateTime}`);
+    } else {
+        failCount++;
+        console.warn(`⚠️ Arıza ${i} alınamadı veya parse edilemedi`);
+    }
+}
+            
+            // İşlem tamamlandı
+            updateProgress(totalCount, totalCount);
+            updateElement('progressText', `İşlem tamamlandı!`);
+            
+            // Son tabloyu güncelle
+            updateTable();
+            updateElement('lastQuery', new Date().toLocaleTimeString());
+            
+            // Özet mesajı
+            const summaryMsg = `✅ Toplam ${successCount} arıza kaydı başarıyla alındı` + 
+                              (failCount > 0 ? ` (${failCount} başarısız)` : '');
+            showMessage(summaryMsg, 'success');
+            
+            // 3 saniye sonra progress'i gizle
+            setTimeout(() => {
+                progressSection.style.display = 'none';
+            }, 3000);
+            
+        } catch (error) {
+            console.error('Toplu arıza sorgulama hatası:', error);
+            showMessage('❌ Arıza kayıtları alınırken hata oluştu', 'error');
+            progressSection.style.display = 'none';
+            
+        } finally {
+            // UI'ı normale döndür
+            isLoading = false;
+            fetchAllFaultsBtn.disabled = false;
+            btnIcon.style.display = 'inline';
+            btnLoader.style.display = 'none';
+            btnIcon.textContent = '📥';
+            btnText.textContent = 'Arıza Kayıtlarını İste';
+        }
+    }
+    
+    // Event listener'lar
+    
+    // Tüm arızaları al butonu
+    fetchAllFaultsBtn.addEventListener('click', fetchAllFaults);
+    
+    // Yenile butonu
+    if (refreshFaultBtn) {
+        refreshFaultBtn.addEventListener('click', () => {
+            updateTable();
+            showMessage('✅ Tablo yenilendi', 'info');
+        });
+    }
+    
+    // Temizle butonu
+    if (clearFaultBtn) {
+        clearFaultBtn.addEventListener('click', () => {
+            if (faultRecords.length === 0) {
+                showMessage('Temizlenecek kayıt yok', 'warning');
+                return;
+            }
+            
+            if (confirm(`${faultRecords.length} adet arıza kaydını tablodan temizlemek istediğinizden emin misiniz?`)) {
+                faultRecords = [];
+                updateTable();
+                updateElement('systemFaultCount', '-');
+                showMessage('✅ Tablo temizlendi', 'success');
+            }
+        });
+    }
+    
+    // Filtre değişimi
+    if (filterPinType) {
+        filterPinType.addEventListener('change', updateTable);
+    }
+    
+    // CSV Export
+    if (exportCSVBtn) {
+        exportCSVBtn.addEventListener('click', () => {
+            if (faultRecords.length === 0) {
+                showMessage('❌ Dışa aktarılacak arıza kaydı bulunamadı', 'warning');
+                return;
+            }
+            
+            exportFaultsAsCSV(filteredRecords.length > 0 ? filteredRecords : faultRecords);
+        });
+    }
+    
+    // Excel Export
+    if (exportExcelBtn) {
+        exportExcelBtn.addEventListener('click', () => {
+            if (faultRecords.length === 0) {
+                showMessage('❌ Dışa aktarılacak arıza kaydı bulunamadı', 'warning');
+                return;
+            }
+            
+            exportFaultsAsExcel(filteredRecords.length > 0 ? filteredRecords : faultRecords);
+        });
+    }
+    
+    // Manuel test form handler
+    if (manualTestForm) {
+        // Hızlı komut butonları
+        document.querySelectorAll('.quick-commands .btn').forEach(btn => {
+            btn.addEventListener('click', function() {
+                const command = this.dataset.cmd;
+                const commandInput = document.getElementById('manualCommand');
+                if (commandInput) {
+                    commandInput.value = command;
+                    commandInput.focus();
+                }
+            });
+        });
+        
+        // Manuel test form submit
+        manualTestForm.addEventListener('submit', async function(e) {
+            e.preventDefault();
+            
+            const command = document.getElementById('manualCommand').value.trim();
+            if (!command) {
+                showMessage('Komut boş olamaz', 'warning');
+                return;
+            }
+            
+            const submitBtn = this.querySelector('button[type="submit"]');
+            const btnText = submitBtn.querySelector('.btn-text');
+            const btnLoader = submitBtn.querySelector('.btn-loader');
+            
+            // Loading state
+            submitBtn.disabled = true;
+            btnText.style.display = 'none';
+            btnLoader.style.display = 'inline-block';
+            
+            try {
+                const formData = new URLSearchParams();
+                formData.append('command', command);
+                
+                const response = await secureFetch('/api/uart/send', {
+                    method: 'POST',
+                    body: formData
+                });
+                
+                if (response && response.ok) {
+                    const data = await response.json();
+                    showManualTestResult(data);
+                } else {
+                    showMessage('❌ Manuel test başarısız oldu', 'error');
+                }
+                
+            } catch (error) {
+                console.error('Manuel test hatası:', error);
+                showMessage('❌ Manuel test sırasında hata oluştu', 'error');
+            } finally {
+                // Reset loading state
+                submitBtn.disabled = false;
+                btnText.style.display = 'inline';
+                btnLoader.style.display = 'none';
+            }
+        });
+        
+        // Temizle butonu
+        document.getElementById('clearManualTest')?.addEventListener('click', function() {
+            document.getElementById('manualCommand').value = '';
+            document.getElementById('manualTestResult').style.display = 'none';
+            showMessage('Manuel test alanı temizlendi', 'info');
+        });
+    }
+    
+    // Canlı UART konsolu
+    const consoleForm = document.getElementById('uartConsoleForm');
+    if (consoleForm) {
+        const output = document.getElementById('uartConsoleOutput');
+        const status = document.getElementById('uartConsoleStatus');
+        const input = document.getElementById('uartConsoleInput');
+        const connectBtn = document.getElementById('uartConsoleConnect');
+        
+        connectBtn.addEventListener('click', () => {
+            if (uartConsole.socket) {
+                stopUARTConsole();
+            } else {
+                startUARTConsole(output, status, input);
+            }
+        });
+        
+        document.getElementById('uartConsoleClear').addEventListener('click', () => {
+            output.innerHTML = '';
+        });
+        
+        consoleForm.addEventListener('submit', e => {
+            e.preventDefault();
+            const command = input.value.trim();
+            if (!command) return;
+            if (sendConsoleCommand(command)) {
+                input.value = '';
+            } else {
+                showMessage('Konsol bağlı değil', 'warning');
+            }
+        });
+    }
+    
+    // Manuel test sonucunu göster
+    function showManualTestResult(data) {
+        const resultDiv = document.getElementById('manualTestResult');
+        const contentDiv = document.getElementById('manualTestContent');
+        
+        if (!resultDiv || !contentDiv) return;
+        
+        let resultHTML = `
+            <div class="test-result-item">
+                <strong>Gönderilen Komut:</strong>
+                <code style="font-family: monospace; background: var(--bg-tertiary); padding: 2px 6px; border-radius: 3px;">${data.command}</code>
+            </div>
+            <div class="test-result-item">
+                <strong>Durum:</strong>
+                <span class="status-badge ${data.success ? 'active' : 'error'}">
+                    ${data.success ? 'Başarılı' : 'Başarısız'}
+                </span>
+            </div>
+            <div class="test-result-item">
+                <strong>Yanıt Uzunluğu:</strong>
+                <span>${data.responseLength} karakter</span>
+            </div>
+            <div class="test-result-item">
+                <strong>Zaman:</strong>
+                <span>${data.timestamp}</span>
+            </div>
+        `;
+        
+        if (data.responseLength > 0) {
+            resultHTML += `
+                <div class="test-result-item" style="flex-direction: column; align-items: flex-start;">
+                    <strong style="margin-bottom: 0.5rem;">dsPIC Yanıtı:</strong>
+                    <div class="test-result-response" style="
+                        background: var(--bg-tertiary); 
+                        padding: 0.5rem; 
+                        border-radius: 4px; 
+                        font-family: monospace; 
+                        font-size: 0.875rem;
+                        word-break: break-all;
+                        width: 100%;">
+                        ${escapeHtml(data.response)}
+                    </div>
+                </div>
+            `;
+        } else {
+            resultHTML += `
+                <div class="test-result-item">
+                    <strong>dsPIC Yanıtı:</strong>
+                    <span class="test-result-empty" style="color: var(--text-tertiary);">Yanıt alınamadı</span>
+                </div>
+            `;
+        }
+        
+        contentDiv.innerHTML = resultHTML;
+        resultDiv.style.display = 'block';
+        resultDiv.scrollIntoView({ behavior: 'smooth' });
+        
+        showMessage(
+            data.success ? 
+            `✅ Komut başarılı: ${data.responseLength} karakter yanıt` : 
+            '❌ Komut başarısız (timeout)', 
+            data.success ? 'success' : 'error'
+        );
+    }
+    
+    // CSV Export fonksiyonu
+    function exportFaultsAsCSV(records) {
+        try {
+            const BOM = '\uFEFF';
+            let csvContent = 'sep=;\n';
+            
+            // Header
+            csvContent += '"Sıra";"Arıza No";"Pin No";"Pin Tipi";"Pin Adı";"Tarih-Saat";"Arıza Süresi";"Süre (sn)";"Ham Veri"\n';
+            
+            // Data rows
+            records.forEach((record, index) => {
+                const dateTimeWithMs = `${record.dateTime}.${record.millisecond}`;
+                const faultNo = record.faultNo ? record.faultNo.toString().padStart(5, '0') : (index + 1).toString().padStart(5, '0');
+                
+                const row = [
+                    index + 1,
+                    faultNo,
+                    record.pinNumber,
+                    record.pinType,
+                    record.pinName,
+                    dateTimeWithMs,
+                    record.duration,
+                    record.durationSeconds || 0,
+                    record.rawData
+                ];
+                
+                const escapedRow = row.map(field => {
+                    const str = String(field).replace(/"/g, '""');
+                    return `"${str}"`;
+                });
+                
+                csvContent += escapedRow.join(';') + '\n';
+            });
+            
+            const blob = new Blob([BOM + csvContent], { 
+                type: 'text/csv;charset=utf-8' 
+            });
+            
+            const now = new Date();
+            const dateStr = now.toISOString().slice(0, 10);
+            const timeStr = now.toTimeString().slice(0, 5).replace(':', '');
+            const filename = `teias_eklim_faults_${dateStr}_${timeStr}.csv`;
+            
+            const url = URL.createObjectURL(blob);
+            const a = document.createElement('a');
+            a.href = url;
+            a.download = filename;
+            a.style.display = 'none';
+            
+            document.body.appendChild(a);
+            a.click();
+            document.body.removeChild(a);
+            URL.revokeObjectURL(url);
+            
+            showMessage(`✅ ${records.length} arıza kaydı CSV olarak dışa aktarıldı`, 'success');
+            
+        } catch (error) {
+            console.error('CSV export hatası:', error);
+            showMessage('❌ CSV dışa aktarma sırasında hata oluştu', 'error');
+        }
+    }
+
+// Excel Export fonksiyonu - GÜNCELLENMİŞ
+function exportFaultsAsExcel(records) {
+    try {
+        let xmlContent = '<?xml version="1.0" encoding="UTF-8"?>\n';
+        xmlContent += '<Workbook xmlns="urn:schemas-microsoft-com:office:spreadsheet"\n';
+        xmlContent += ' xmlns:o="urn:schemas-microsoft-com:office:office"\n';
+        xmlContent += ' xmlns:x="urn:schemas-microsoft-com:office:excel"\n';
+        xmlContent += ' xmlns:ss="urn:schemas-microsoft-com:office:spreadsheet"\n';
+        xmlContent += ' xmlns:html="https://www.w3.org/TR/REC-html40">\n';
+        
+        // Document Properties
+        xmlContent += '<DocumentProperties xmlns="urn:schemas-microsoft-com:office:office">\n';
+        xmlContent += '<Title>TEİAŞ EKLİM Arıza Kayıtları</Title>\n';
+        xmlContent += '<Author>TEİAŞ EKLİM Sistemi</Author>\n';
+        xmlContent += '<Created>' + new Date().toISOString() + '</Created>\n';
+        xmlContent += '<Company>TEİAŞ</Company>\n';
+        xmlContent += '</DocumentProperties>\n';
+        
+        // Styles
+        xmlContent += '<Styles>\n';
+        xmlContent += '<Style ss:ID="Header">\n';
+        xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#FFFFFF" ss:Bold="1"/>\n';
+        xmlContent += '<Interior ss:Color="#4F81BD" ss:Pattern="Solid"/>\n';
+        xmlContent += '<Borders>\n';
+        xmlContent += '<Border ss:Position="Bottom" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+        xmlContent += '<Border ss:Position="Left" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+        xmlContent += '<Border ss:Position="Right" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+        xmlContent += '<Border ss:Position="Top" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+        xmlContent += '</Borders>\n';
+        xmlContent += '</Style>\n';
+        
+        xmlContent += '<Style ss:ID="Output">\n';
+        xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#006100"/>\n';
+        xmlContent += '<Interior ss:Color="#C6EFCE" ss:Pattern="Solid"/>\n';
+        xmlContent += '</Style>\n';
+        
+        xmlContent += '<Style ss:ID="Input">\n';
+        xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#0F1494"/>\n';
+        xmlContent += '<Interior ss:Color="#B7DEE8" ss:Pattern="Solid"/>\n';
+        xmlContent += '</Style>\n';
+        
+        xmlContent += '</Styles>\n';
+        
+        // Worksheet
+        xmlContent += '<Worksheet ss:Name="Arıza Kayıtları">\n';
+        xmlContent += '<Table ss:ExpandedColumnCount="8" ss:ExpandedRowCount="' + (records.length + 1) + '" x:FullColumns="1" x:FullRows="1">\n';
+        
+        // Column definitions - Milisaniye sütunu kaldırıldı
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="50"/>\n';   // Sıra
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="60"/>\n';   // Pin No
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="70"/>\n';   // Pin Tipi
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="100"/>\n';  // Pin Adı
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="160"/>\n';  // Tarih-Saat (genişletildi)
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="100"/>\n';  // Arıza Süresi
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="80"/>\n';   // Süre (sn)
+        xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="150"/>\n';  // Ham Veri
+        
+        // Header row
+        xmlContent += '<Row ss:StyleID="Header">\n';
+        xmlContent += '<Cell><Data ss:Type="String">Sıra</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Pin No</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Pin Tipi</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Pin Adı</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Tarih-Saat</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Arıza Süresi</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Süre (sn)</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Ham Veri</Data></Cell>\n';
+        xmlContent += '</Row>\n';
+        
+        // Data rows
+        records.forEach((record, index) => {
+            const styleID = record.pinType === 'Çıkış' ? 'Output' : 'Input';
+            
+            // Tarih-saat + milisaniye birleşik
+            const dateTimeWithMs = `${record.dateTime}.${record.millisecond}`;
+            
+            xmlContent += `<Row ss:StyleID="${styleID}">\n`;
+            xmlContent += `<Cell><Data ss:Type="Number">${index + 1}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="Number">${record.pinNumber}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(record.pinType)}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(record.pinName)}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(dateTimeWithMs)}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(record.duration)}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="Number">${record.durationSeconds || 0}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(record.rawData)}</Data></Cell>\n`;
+            xmlContent += '</Row>\n';
+        });
+        
+        xmlContent += '</Table>\n';
+        xmlContent += '</Worksheet>\n';
+        xmlContent += '</Workbook>';
+        
+        // XML escape helper function
+        function escapeXml(str) {
+            if (!str) return '';
+            return str.toString().replace(/[<>&'"]/g, function (c) {
+                switch (c) {
+                    case '<': return '&lt;';
+                    case '>': return '&gt;';
+                    case '&': return '&amp;';
+                    case "'": return '&apos;';
+                    case '"': return '&quot;';
+                    default: return c;
+                }
+            });
+        }
+        
+        // Create and download file
+        const BOM = '\uFEFF';
+        const blob = new Blob([BOM + xmlContent], { 
+            type: 'application/vnd.ms-excel;charset=utf-8' 
+        });
+        
+        const now = new Date();
+        const dateStr = now.toISOString().slice(0, 10);
+        const timeStr = now.toTimeString().slice(0, 5).replace(':', '');
+        const filename = `teias_eklim_faults_${dateStr}_${timeStr}.xls`;
+        
+        const url = URL.createObjectURL(blob);
+        const a = document.createElement('a');
+        a.href = url;
+        a.download = filename;
+        a.style.display = 'none';
+        
+        document.body.appendChild(a);
+        a.click();
+        document.body.removeChild(a);
+        URL.revokeObjectURL(url);
+        
+        showMessage(`✅ ${records.length} arıza kaydı renkli Excel formatında dışa aktarıldı`, 'success');
+        
+    } catch (error) {
+        console.error('Excel export hatası:', error);
+        showMessage('❌ Excel dışa aktarma sırasında hata oluştu', 'error');
+    }
+}
+
+// Helper functions
+    function escapeHtml(text) {
+        const map = {
+            '&': '&amp;',
+            '<': '&lt;',
+            '>': '&gt;',
+            '"': '&quot;',
+            "'": '&#039;'
+        };
+        return text.replace(/[&<>"']/g, function(m) { return map[m]; });
+    }
+    
+    function updateElement(id, value) {
+        const element = document.getElementById(id);
+        if (element) {
+            element.textContent = value;
+        }
+    }
+    
+    // İlk yüklemede tabloyu boş göster
+    updateTable();
+    
+    console.log('✅ Fault sayfası hazır (Toplu sorgulama versiyonu)');
+}
+
+    // --- CANLI UART KONSOLU (/api/uart/console, WebSocket) ---
+    const uartConsole = {
+        socket: null,
+        maxLines: 500
+    };
+
+    function appendConsoleLine(output, text, cls) {
+        const line = document.createElement('div');
+        if (cls) line.className = cls;
+        line.textContent = text;
+        output.appendChild(line);
+        while (output.childElementCount > uartConsole.maxLines) {
+            output.removeChild(output.firstChild);
+        }
+        output.scrollTop = output.scrollHeight;
+    }
+
+    function formatConsoleMessage(msg) {
+        if (msg.type === 'tx' || msg.type === 'rx') {
+            // t: ESP32 micros() - göreli sıralama için yeterli
+            const time = (msg.t / 1000000).toFixed(6);
+            const arrow = msg.type === 'tx' ? 'TX →' : 'RX ←';
+            const flags = (msg.timeout ? ' [timeout]' : '') + (msg.truncated ? ' [kesildi]' : '');
+            // data ASCII gelir: yazdırılamayan baytlar cihazda \xHH, ters bölü \\ olarak kaçırılır
+            return { text: `${time}  ${arrow} ${msg.data}${flags}`, cls: msg.timeout ? 'error' : msg.type };
+        }
+        if (msg.type === 'result') {
+            const status = msg.success ? '✅' : '❌';
+            return { text: `${status} ${msg.command} (${msg.ms} ms)`, cls: msg.success ? '' : 'error' };
+        }
+        return null;
+    }
+
+    function startUARTConsole(output, status, input) {
+        if (uartConsole.socket || !state.token || !window.WebSocket) return;
+
+        const scheme = location.protocol === 'https:' ? 'wss' : 'ws';
+        const socket = new WebSocket(`${scheme}://${location.host}/api/uart/console?token=${encodeURIComponent(state.token)}`);
+        uartConsole.socket = socket;
+        status.textContent = 'Bağlanıyor...';
+
+        socket.onopen = () => {
+            status.textContent = 'Bağlı';
+            status.classList.add('active');
+            input.disabled = false;
+            input.focus();
+        };
+        socket.onmessage = event => {
+            let msg;
+            try { msg = JSON.parse(event.data); } catch (e) { return; }
+            if (msg.type === 'auth') {
+                stopUARTConsole();
+                logout();
+                return;
+            }
+            const line = formatConsoleMessage(msg);
+            if (line) appendConsoleLine(output, line.text, line.cls);
+        };
+        socket.onclose = () => {
+            if (uartConsole.socket === socket) uartConsole.socket = null;
+            status.textContent = 'Bağlı değil';
+            status.classList.remove('active');
+            input.disabled = true;
+        };
+    }
+
+    function stopUARTConsole() {
+        if (uartConsole.socket) uartConsole.socket.close();
+        uartConsole.socket = null;
+    }
+
+    function sendConsoleCommand(command) {
+        if (!uartConsole.socket || uartConsole.socket.readyState !== WebSocket.OPEN) return false;
+        uartConsole.socket.send(command);
+        return true;
+    }
+
+    App.registerPage('fault', initFaultPage, stopUARTConsole);
+})(window.App);
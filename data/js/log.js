@@ -0,0 +1,876 @@
+// js/log.js - Log kayıtları sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { state, secureFetch, showMessage, updateElement, serverEvents, onServerEvent } = App;
+
+// Log Kayıtları Sayfası - GÜNCELLENMİŞ
+function initLogPage() {
+    const logContainer = document.getElementById('logContainer');
+    const pauseLogsBtn = document.getElementById('pauseLogsBtn');
+    const exportLogsBtn = document.getElementById('exportLogsBtn');
+    const refreshLogsBtn = document.getElementById('refreshLogsBtn');
+    const clearLogsBtn = document.getElementById('clearLogsBtn');
+    const autoScrollToggle = document.getElementById('autoScrollToggle');
+    const autoRefreshToggle = document.getElementById('autoRefreshToggle');
+    const refreshInterval = document.getElementById('refreshInterval');
+    const logSearch = document.getElementById('logSearch');
+    const logLevelFilter = document.getElementById('logLevelFilter');
+    const logSourceFilter = document.getElementById('logSourceFilter');
+    const clearFiltersBtn = document.getElementById('clearFiltersBtn');
+    
+    if (!logContainer) {
+        console.warn('Log container bulunamadı');
+        return;
+    }
+    
+    console.log('🔍 Log filtreleme sistemi başlatılıyor...');
+    
+    // Log verileri ve filtreler
+    let allLogs = [];
+    let filteredLogs = [];
+    let autoRefreshActive = true;
+    let autoScrollActive = true;
+    let refreshIntervalId = null;
+    
+    // Mevcut filtreler
+    const currentFilters = {
+        search: '',
+        level: 'all',
+        source: 'all'
+    };
+
+    // Logları filtrele
+    function applyFilters() {
+        console.log('Filtreler uygulanıyor:', currentFilters);
+        
+        filteredLogs = allLogs.filter(log => {
+            // Seviye filtresi
+            if (currentFilters.level !== 'all' && log.l !== currentFilters.level) {
+                return false;
+            }
+            
+            // Kaynak filtresi
+            if (currentFilters.source !== 'all' && log.s !== currentFilters.source) {
+                return false;
+            }
+            
+            // Arama filtresi - hem mesajda hem de kaynakta ara
+            if (currentFilters.search) {
+                const searchTerm = currentFilters.search.toLowerCase();
+                const messageMatch = log.m.toLowerCase().includes(searchTerm);
+                const sourceMatch = log.s.toLowerCase().includes(searchTerm);
+                const levelMatch = log.l.toLowerCase().includes(searchTerm);
+                
+                if (!messageMatch && !sourceMatch && !levelMatch) {
+                    return false;
+                }
+            }
+            
+            return true;
+        });
+        
+        console.log(`Filtreleme sonucu: ${filteredLogs.length}/${allLogs.length} log`);
+        renderLogs();
+        updateLogStats();
+        updateFilterBadges();
+    }
+
+    // Logları ekranda göster
+    function renderLogs() {
+        if (!logContainer) return;
+        
+        // Loading spinner'ı kaldır
+        const loadingElement = logContainer.querySelector('.loading-logs');
+        if (loadingElement) {
+            loadingElement.remove();
+        }
+        
+        // Mevcut logları temizle
+        logContainer.innerHTML = '';
+        
+        if (filteredLogs.length === 0) {
+            const emptyMessage = allLogs.length === 0 ? 
+                'Henüz log kaydı yok. Sistem çalıştıkça loglar burada görünecek.' :
+                `Filtreleme kriterlerine uygun log bulunamadı. (${allLogs.length} log var)`;
+                
+            logContainer.innerHTML = `
+                <div class="empty-state">
+                    <div class="empty-icon">🔍</div>
+                    <h4>Log bulunamadı</h4>
+                    <p>${emptyMessage}</p>
+                    ${currentFilters.search || currentFilters.level !== 'all' || currentFilters.source !== 'all' ? 
+                        '<button class="btn secondary small" onclick="clearAllFilters()">🧹 Filtreleri Temizle</button>' : ''}
+                </div>
+            `;
+            return;
+        }
+
+        // Fragment kullanarak performansı artır
+        const fragment = document.createDocumentFragment();
+        
+        filteredLogs.forEach(log => {
+            const logEntry = document.createElement('div');
+            logEntry.className = `log-entry log-${log.l.toLowerCase()}`;
+            
+            // Arama terimini vurgula
+            let highlightedMessage = log.m;
+            if (currentFilters.search) {
+                const regex = new RegExp(`(${escapeRegExp(currentFilters.search)})`, 'gi');
+                highlightedMessage = log.m.replace(regex, '<mark>$1</mark>');
+            }
+            
+            logEntry.innerHTML = `
+                <span class="log-time" title="Tam tarih: ${log.t}">${log.t}</span>
+                <span class="log-level level-${log.l.toLowerCase()}" title="Log seviyesi">${log.l}</span>
+                <span class="log-source" title="Log kaynağı">${log.s}</span>
+                <span class="log-message">${highlightedMessage}</span>
+            `;
+            
+            fragment.appendChild(logEntry);
+        });
+        
+        logContainer.appendChild(fragment);
+        
+        // Otomatik kaydırma
+        if (autoScrollActive) {
+            setTimeout(() => {
+                logContainer.scrollTop = logContainer.scrollHeight;
+            }, 100);
+        }
+    }
+
+    // İstatistikleri güncelle
+    function updateLogStats() {
+        updateElement('totalLogs', allLogs.length.toString());
+        
+        const errorCount = allLogs.filter(log => log.l === 'ERROR').length;
+        const warningCount = allLogs.filter(log => log.l === 'WARN').length;
+        
+        updateElement('errorCount', errorCount.toString());
+        updateElement('warningCount', warningCount.toString());
+        updateElement('lastLogUpdate', new Date().toLocaleTimeString());
+    }
+
+    // Filtre badge'lerini güncelle (aktif filtre sayısını göster)
+    function updateFilterBadges() {
+        let activeFilterCount = 0;
+        
+        if (currentFilters.search) activeFilterCount++;
+        if (currentFilters.level !== 'all') activeFilterCount++;
+        if (currentFilters.source !== 'all') activeFilterCount++;
+        
+        // Filtre butonuna badge ekle
+        if (clearFiltersBtn) {
+            clearFiltersBtn.textContent = activeFilterCount > 0 ? 
+                `🧹 Filtreleri Temizle (${activeFilterCount})` : 
+                '🧹 Filtreleri Temizle';
+            clearFiltersBtn.style.display = activeFilterCount > 0 ? 'block' : 'none';
+        }
+        
+        // Input'lara aktif class ekle
+        const searchInput = document.getElementById('logSearch');
+        const levelSelect = document.getElementById('logLevelFilter');
+        const sourceSelect = document.getElementById('logSourceFilter');
+        
+        if (searchInput) {
+            searchInput.classList.toggle('filter-active', !!currentFilters.search);
+        }
+        if (levelSelect) {
+            levelSelect.classList.toggle('filter-active', currentFilters.level !== 'all');
+        }
+        if (sourceSelect) {
+            sourceSelect.classList.toggle('filter-active', currentFilters.source !== 'all');
+        }
+    }
+
+    // RegExp escape helper
+    function escapeRegExp(string) {
+        return string.replace(/[.*+?^${}()|[\]\\]/g, '\\$&');
+    }
+
+    // Logları API'den çek
+    async function fetchLogs() {
+        if (state.logPaused) {
+            console.log('Log yenileme duraklatıldı');
+            return;
+        }
+        
+        try {
+            const response = await secureFetch('/api/logs');
+            if (response && response.ok) {
+                const logs = await response.json();
+                if (Array.isArray(logs)) {
+                    allLogs = logs;
+                    
+                    // Kaynak listesini güncelle
+                    updateSourceFilter();
+                    
+                    // Filtreleri uygula
+                    applyFilters();
+                    
+                    console.log(`✅ ${logs.length} log yüklendi`);
+                } else {
+                    console.error('Geçersiz log formatı:', logs);
+                }
+            }
+        } catch (error) {
+            console.error('Log yükleme hatası:', error);
+            if (!logContainer.innerHTML.includes('error')) {
+                showMessage('Log kayıtları yüklenemedi', 'error');
+            }
+        }
+    }
+
+    // Kaynak filtresini dinamik olarak güncelle
+    function updateSourceFilter() {
+        if (!logSourceFilter) return;
+        
+        const sources = new Set(['all']);
+        allLogs.forEach(log => sources.add(log.s));
+        
+        const currentValue = logSourceFilter.value;
+        
+        // Mevcut seçenekleri temizle (all hariç)
+        while (logSourceFilter.children.length > 1) {
+            logSourceFilter.removeChild(logSourceFilter.lastChild);
+        }
+        
+        // Yeni seçenekler ekle
+        Array.from(sources).sort().forEach(source => {
+            if (source !== 'all') {
+                const option = document.createElement('option');
+                option.value = source;
+                option.textContent = source;
+                logSourceFilter.appendChild(option);
+            }
+        });
+        
+        // Eski değeri geri yükle
+        if (sources.has(currentValue)) {
+            logSourceFilter.value = currentValue;
+        }
+    }
+
+    // Yenileme interval'ini ayarla
+    function setRefreshInterval(interval) {
+        if (refreshIntervalId) {
+            clearInterval(refreshIntervalId);
+        }
+        
+        if (autoRefreshActive && interval > 0) {
+            // Olay akışı açıkken yeni loglar 'log' olayıyla gelir
+            refreshIntervalId = setInterval(() => {
+                if (!serverEvents.connected) fetchLogs();
+            }, interval);
+            console.log(`Otomatik yenileme ${interval/1000}s aralıkla ayarlandı`);
+        }
+    }
+
+    // Global clear function (empty state'ten çağrılabilir)
+    window.clearAllFilters = function() {
+        if (logSearch) logSearch.value = '';
+        if (logLevelFilter) logLevelFilter.value = 'all';
+        if (logSourceFilter) logSourceFilter.value = 'all';
+        
+        currentFilters.search = '';
+        currentFilters.level = 'all';
+        currentFilters.source = 'all';
+        
+        applyFilters();
+        showMessage('Tüm filtreler temizlendi', 'info');
+    };
+
+    // EVENT LISTENERS
+
+    // Arama filtresi
+    if (logSearch) {
+        // Debounce için timer
+        let searchTimeout;
+        
+        logSearch.addEventListener('input', (e) => {
+            clearTimeout(searchTimeout);
+            
+            searchTimeout = setTimeout(() => {
+                currentFilters.search = e.target.value.trim();
+                console.log('Arama terimi:', currentFilters.search);
+                applyFilters();
+            }, 300); // 300ms bekle
+        });
+        
+        // Enter tuşu ile hemen ara
+        logSearch.addEventListener('keypress', (e) => {
+            if (e.key === 'Enter') {
+                clearTimeout(searchTimeout);
+                currentFilters.search = e.target.value.trim();
+                applyFilters();
+            }
+        });
+    }
+
+    // Seviye filtresi
+    if (logLevelFilter) {
+        logLevelFilter.addEventListener('change', (e) => {
+            currentFilters.level = e.target.value;
+            console.log('Seviye filtresi:', currentFilters.level);
+            applyFilters();
+        });
+    }
+
+    // Kaynak filtresi
+    if (logSourceFilter) {
+        logSourceFilter.addEventListener('change', (e) => {
+            currentFilters.source = e.target.value;
+            console.log('Kaynak filtresi:', currentFilters.source);
+            applyFilters();
+        });
+    }
+
+    // Filtreleri temizle butonu
+    if (clearFiltersBtn) {
+        clearFiltersBtn.addEventListener('click', window.clearAllFilters);
+    }
+
+    // Yenile butonu
+    if (refreshLogsBtn) {
+        refreshLogsBtn.addEventListener('click', () => {
+            console.log('Manuel log yenileme');
+            fetchLogs();
+        });
+    }
+
+    // Duraklat/Devam butonu
+    if (pauseLogsBtn) {
+        pauseLogsBtn.addEventListener('click', () => {
+            state.logPaused = !state.logPaused;
+            
+            const btnIcon = pauseLogsBtn.querySelector('.btn-icon');
+            const btnText = pauseLogsBtn.querySelector('.btn-text');
+            
+            if (state.logPaused) {
+                btnIcon.textContent = '▶️';
+                btnText.textContent = 'Devam Et';
+                pauseLogsBtn.classList.add('paused');
+                showMessage('Log akışı duraklatıldı', 'info');
+            } else {
+                btnIcon.textContent = '⏸️';
+                btnText.textContent = 'Duraklat';
+                pauseLogsBtn.classList.remove('paused');
+                showMessage('Log akışı devam ediyor', 'info');
+                fetchLogs(); // Hemen yenile
+            }
+        });
+    }
+
+    // Export butonu - Türkçe karakter desteği ile düzeltilmiş
+if (exportLogsBtn) {
+    exportLogsBtn.addEventListener('click', () => {
+        if (allLogs.length === 0) {
+            showMessage('Dışa aktarılacak log kaydı bulunamadı', 'warning');
+            return;
+        }
+        
+        try {
+            // Filtrelenmiş logları kullan (kullanıcının gördüğü loglar)
+            const logsToExport = filteredLogs.length > 0 ? filteredLogs : allLogs;
+            
+            // CSV içeriği oluştur - UTF-8 BOM ile
+            const BOM = '\uFEFF'; // UTF-8 Byte Order Mark
+            
+            // Excel'in Türkçe karakterleri doğru tanıması için separator belirt
+            let csvContent = 'sep=;\n'; // Noktalı virgül ayırıcı (Türkiye için)
+            
+            // Header ekle
+            csvContent += '"Zaman";"Seviye";"Kaynak";"Mesaj"\n';
+            
+            // Her log kaydını işle
+            logsToExport.forEach(log => {
+                // Mesajdaki çift tırnakları escape et
+                const cleanMessage = log.m
+                    .replace(/"/g, '""') // CSV kuralı: çift tırnak için ""
+                    .replace(/[\r\n\t]/g, ' ') // Yeni satır ve tab karakterlerini boşlukla değiştir
+                    .trim(); // Başta/sonda boşlukları temizle
+                
+                // Türkçe karakterleri koru
+                const time = log.t || '';
+                const level = log.l || '';
+                const source = log.s || '';
+                
+                // CSV satırı oluştur - noktalı virgül ile
+                csvContent += `"${time}";"${level}";"${source}";"${cleanMessage}"\n`;
+            });
+            
+            // Blob oluştur - UTF-8 encoding ile
+            const blob = new Blob([BOM + csvContent], { 
+                type: 'text/csv;charset=utf-8' 
+            });
+            
+            // Dosya adı oluştur - Türkçe karaktersiz
+            const now = new Date();
+            const dateStr = now.toISOString().slice(0, 10); // YYYY-MM-DD
+            const timeStr = now.toTimeString().slice(0, 5).replace(':', ''); // HHMM
+            const filename = `teias_eklim_logs_${dateStr}_${timeStr}.csv`;
+            
+            // İndir
+            const url = URL.createObjectURL(blob);
+            const a = document.createElement('a');
+            a.href = url;
+            a.download = filename;
+            a.style.display = 'none';
+            
+            document.body.appendChild(a);
+            a.click();
+            document.body.removeChild(a);
+            
+            // Memory cleanup
+            URL.revokeObjectURL(url);
+            
+            showMessage(`✅ ${logsToExport.length} log kaydı Excel uyumlu CSV olarak dışa aktarıldı`, 'success');
+            
+        } catch (error) {
+            console.error('Export hatası:', error);
+            showMessage('❌ Dışa aktarma sırasında hata oluştu: ' + error.message, 'error');
+        }
+    });
+}
+
+// Alternatif - Excel XLSX formatında export (bonus özellik)
+// Bu fonksiyonu da ekleyebilirsiniz
+function exportToExcel() {
+    if (allLogs.length === 0) {
+        showMessage('Dışa aktarılacak log kaydı bulunamadı', 'warning');
+        return;
+    }
+    
+    try {
+        // Basit Excel XML formatı (Excel 2003+ uyumlu)
+        const logsToExport = filteredLogs.length > 0 ? filteredLogs : allLogs;
+        
+        let xmlContent = '<?xml version="1.0" encoding="UTF-8"?>\n';
+        xmlContent += '<Workbook xmlns="urn:schemas-microsoft-com:office:spreadsheet"\n';
+        xmlContent += ' xmlns:o="urn:schemas-microsoft-com:office:office"\n';
+        xmlContent += ' xmlns:x="urn:schemas-microsoft-com:office:excel"\n';
+        xmlContent += ' xmlns:ss="urn:schemas-microsoft-com:office:spreadsheet"\n';
+        xmlContent += ' xmlns:html="http://www.w3.org/TR/REC-html40">\n';
+        xmlContent += '<DocumentProperties xmlns="urn:schemas-microsoft-com:office:office">\n';
+        xmlContent += '<Title>TEİAŞ EKLİM Log Kayıtları</Title>\n';
+        xmlContent += '<Author>TEİAŞ EKLİM Sistemi</Author>\n';
+        xmlContent += '<Created>' + new Date().toISOString() + '</Created>\n';
+        xmlContent += '</DocumentProperties>\n';
+        xmlContent += '<Styles>\n';
+        xmlContent += '<Style ss:ID="Header">\n';
+        xmlContent += '<Font ss:Bold="1"/>\n';
+        xmlContent += '<Interior ss:Color="#CCCCCC" ss:Pattern="Solid"/>\n';
+        xmlContent += '</Style>\n';
+        xmlContent += '<Style ss:ID="Error">\n';
+        xmlContent += '<Interior ss:Color="#FFCCCC" ss:Pattern="Solid"/>\n';
+        xmlContent += '</Style>\n';
+        xmlContent += '<Style ss:ID="Warning">\n';
+        xmlContent += '<Interior ss:Color="#FFFFCC" ss:Pattern="Solid"/>\n';
+        xmlContent += '</Style>\n';
+        xmlContent += '<Style ss:ID="Success">\n';
+        xmlContent += '<Interior ss:Color="#CCFFCC" ss:Pattern="Solid"/>\n';
+        xmlContent += '</Style>\n';
+        xmlContent += '</Styles>\n';
+        xmlContent += '<Worksheet ss:Name="Log Kayıtları">\n';
+        xmlContent += '<Table>\n';
+        
+        // Header row
+        xmlContent += '<Row ss:StyleID="Header">\n';
+        xmlContent += '<Cell><Data ss:Type="String">Zaman</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Seviye</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Kaynak</Data></Cell>\n';
+        xmlContent += '<Cell><Data ss:Type="String">Mesaj</Data></Cell>\n';
+        xmlContent += '</Row>\n';
+        
+        // Data rows
+        logsToExport.forEach(log => {
+            const styleID = log.l === 'ERROR' ? 'Error' : 
+                           log.l === 'WARN' ? 'Warning' : 
+                           log.l === 'SUCCESS' ? 'Success' : '';
+            
+            xmlContent += `<Row${styleID ? ' ss:StyleID="' + styleID + '"' : ''}>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(log.t)}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(log.l)}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(log.s)}</Data></Cell>\n`;
+            xmlContent += `<Cell><Data ss:Type="String">${escapeXml(log.m)}</Data></Cell>\n`;
+            xmlContent += '</Row>\n';
+        });
+        
+        xmlContent += '</Table>\n';
+        xmlContent += '</Worksheet>\n';
+        xmlContent += '</Workbook>\n';
+        
+        // XML escape fonksiyonu
+        function escapeXml(str) {
+            return str.replace(/[<>&'"]/g, function (c) {
+                switch (c) {
+                    case '<': return '&lt;';
+                    case '>': return '&gt;';
+                    case '&': return '&amp;';
+                    case "'": return '&apos;';
+                    case '"': return '&quot;';
+                }
+            });
+        }
+        
+        // Blob oluştur
+        const blob = new Blob([xmlContent], { 
+            type: 'application/vnd.ms-excel;charset=utf-8' 
+        });
+        
+        // İndir
+        const now = new Date();
+        const dateStr = now.toISOString().slice(0, 10);
+        const filename = `teias_eklim_logs_${dateStr}.xls`;
+        
+        const url = URL.createObjectURL(blob);
+        const a = document.createElement('a');
+        a.href = url;
+        a.download = filename;
+        a.style.display = 'none';
+        
+        document.body.appendChild(a);
+        a.click();
+        document.body.removeChild(a);
+        URL.revokeObjectURL(url);
+        
+        showMessage(`✅ ${logsToExport.length} log kaydı Excel XLS formatında dışa aktarıldı`, 'success');
+        
+    } catch (error) {
+        console.error('Excel export hatası:', error);
+        showMessage('❌ Excel dışa aktarma sırasında hata oluştu', 'error');
+    }
+}
+    // Excel Export butonu - Yeni eklenen
+    if (document.getElementById('exportExcelBtn')) {
+        document.getElementById('exportExcelBtn').addEventListener('click', () => {
+            if (allLogs.length === 0) {
+                showMessage('Dışa aktarılacak log kaydı bulunamadı', 'warning');
+                return;
+            }
+            
+            try {
+                // Excel için XML formatı oluştur
+                const logsToExport = filteredLogs.length > 0 ? filteredLogs : allLogs;
+                
+                let xmlContent = '<?xml version="1.0" encoding="UTF-8"?>\n';
+                xmlContent += '<Workbook xmlns="urn:schemas-microsoft-com:office:spreadsheet"\n';
+                xmlContent += ' xmlns:o="urn:schemas-microsoft-com:office:office"\n';
+                xmlContent += ' xmlns:x="urn:schemas-microsoft-com:office:excel"\n';
+                xmlContent += ' xmlns:ss="urn:schemas-microsoft-com:office:spreadsheet"\n';
+                xmlContent += ' xmlns:html="https://www.w3.org/TR/REC-html40">\n';
+                
+                // Document Properties
+                xmlContent += '<DocumentProperties xmlns="urn:schemas-microsoft-com:office:office">\n';
+                xmlContent += '<Title>TEİAŞ EKLİM Log Kayıtları</Title>\n';
+                xmlContent += '<Author>TEİAŞ EKLİM Sistemi</Author>\n';
+                xmlContent += '<Created>' + new Date().toISOString() + '</Created>\n';
+                xmlContent += '<Company>TEİAŞ</Company>\n';
+                xmlContent += '</DocumentProperties>\n';
+                
+                // Styles
+                xmlContent += '<Styles>\n';
+                xmlContent += '<Style ss:ID="Default" ss:Name="Normal">\n';
+                xmlContent += '<Alignment ss:Vertical="Bottom"/>\n';
+                xmlContent += '<Borders/>\n';
+                xmlContent += '<Font ss:FontName="Calibri" x:Family="Swiss" ss:Size="11" ss:Color="#000000"/>\n';
+                xmlContent += '<Interior/>\n';
+                xmlContent += '<NumberFormat/>\n';
+                xmlContent += '<Protection/>\n';
+                xmlContent += '</Style>\n';
+                
+                xmlContent += '<Style ss:ID="Header">\n';
+                xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#FFFFFF" ss:Bold="1"/>\n';
+                xmlContent += '<Interior ss:Color="#4F81BD" ss:Pattern="Solid"/>\n';
+                xmlContent += '<Borders>\n';
+                xmlContent += '<Border ss:Position="Bottom" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+                xmlContent += '<Border ss:Position="Left" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+                xmlContent += '<Border ss:Position="Right" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+                xmlContent += '<Border ss:Position="Top" ss:LineStyle="Continuous" ss:Weight="1"/>\n';
+                xmlContent += '</Borders>\n';
+                xmlContent += '</Style>\n';
+                
+                xmlContent += '<Style ss:ID="Error">\n';
+                xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#9C0006"/>\n';
+                xmlContent += '<Interior ss:Color="#FFC7CE" ss:Pattern="Solid"/>\n';
+                xmlContent += '</Style>\n';
+                
+                xmlContent += '<Style ss:ID="Warning">\n';
+                xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#9C6500"/>\n';
+                xmlContent += '<Interior ss:Color="#FFEB9C" ss:Pattern="Solid"/>\n';
+                xmlContent += '</Style>\n';
+                
+                xmlContent += '<Style ss:ID="Success">\n';
+                xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#006100"/>\n';
+                xmlContent += '<Interior ss:Color="#C6EFCE" ss:Pattern="Solid"/>\n';
+                xmlContent += '</Style>\n';
+                
+                xmlContent += '<Style ss:ID="Info">\n';
+                xmlContent += '<Font ss:FontName="Calibri" ss:Size="11" ss:Color="#0F1494"/>\n';
+                xmlContent += '<Interior ss:Color="#B7DEE8" ss:Pattern="Solid"/>\n';
+                xmlContent += '</Style>\n';
+                
+                xmlContent += '<Style ss:ID="DateTime">\n';
+                xmlContent += '<Font ss:FontName="Consolas" ss:Size="10"/>\n';
+                xmlContent += '<NumberFormat ss:Format="dd/mm/yyyy hh:mm:ss"/>\n';
+                xmlContent += '</Style>\n';
+                
+                xmlContent += '</Styles>\n';
+                
+                // Worksheet
+                xmlContent += '<Worksheet ss:Name="Log Kayıtları">\n';
+                xmlContent += '<Table ss:ExpandedColumnCount="4" ss:ExpandedRowCount="' + (logsToExport.length + 1) + '" x:FullColumns="1" x:FullRows="1" ss:DefaultColumnWidth="60">\n';
+                
+                // Column definitions
+                xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="120"/>\n'; // Zaman
+                xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="80"/>\n';  // Seviye
+                xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="100"/>\n'; // Kaynak
+                xmlContent += '<Column ss:AutoFitWidth="0" ss:Width="300"/>\n'; // Mesaj
+                
+                // Header row
+                xmlContent += '<Row ss:StyleID="Header">\n';
+                xmlContent += '<Cell><Data ss:Type="String">Zaman</Data></Cell>\n';
+                xmlContent += '<Cell><Data ss:Type="String">Seviye</Data></Cell>\n';
+                xmlContent += '<Cell><Data ss:Type="String">Kaynak</Data></Cell>\n';
+                xmlContent += '<Cell><Data ss:Type="String">Mesaj</Data></Cell>\n';
+                xmlContent += '</Row>\n';
+                
+                // Data rows
+                logsToExport.forEach((log, index) => {
+                    let styleID = '';
+                    switch(log.l) {
+                        case 'ERROR':
+                            styleID = 'Error';
+                            break;
+                        case 'WARN':
+                            styleID = 'Warning';
+                            break;
+                        case 'SUCCESS':
+                            styleID = 'Success';
+                            break;
+                        case 'INFO':
+                            styleID = 'Info';
+                            break;
+                        default:
+                            styleID = 'Default';
+                    }
+                    
+                    xmlContent += `<Row ss:StyleID="${styleID}">\n`;
+                    xmlContent += `<Cell ss:StyleID="DateTime"><Data ss:Type="String">${escapeXml(log.t)}</Data></Cell>\n`;
+                    xmlContent += `<Cell><Data ss:Type="String">${escapeXml(log.l)}</Data></Cell>\n`;
+                    xmlContent += `<Cell><Data ss:Type="String">${escapeXml(log.s)}</Data></Cell>\n`;
+                    xmlContent += `<Cell><Data ss:Type="String">${escapeXml(log.m)}</Data></Cell>\n`;
+                    xmlContent += '</Row>\n';
+                });
+                
+                xmlContent += '</Table>\n';
+                
+                // Worksheet Options
+                xmlContent += '<WorksheetOptions xmlns="urn:schemas-microsoft-com:office:excel">\n';
+                xmlContent += '<PageSetup>\n';
+                xmlContent += '<Header x:Margin="0.3"/>\n';
+                xmlContent += '<Footer x:Margin="0.3"/>\n';
+                xmlContent += '<PageMargins x:Bottom="0.75" x:Left="0.7" x:Right="0.7" x:Top="0.75"/>\n';
+                xmlContent += '</PageSetup>\n';
+                xmlContent += '<Selected/>\n';
+                xmlContent += '<FreezePanes/>\n';
+                xmlContent += '<FrozenNoSplit/>\n';
+                xmlContent += '<SplitHorizontal>1</SplitHorizontal>\n';
+                xmlContent += '<TopRowBottomPane>1</TopRowBottomPane>\n';
+                xmlContent += '<ActivePane>2</ActivePane>\n';
+                xmlContent += '<Panes>\n';
+                xmlContent += '<Pane>\n';
+                xmlContent += '<Number>3</Number>\n';
+                xmlContent += '</Pane>\n';
+                xmlContent += '<Pane>\n';
+                xmlContent += '<Number>2</Number>\n';
+                xmlContent += '<ActiveRow>0</ActiveRow>\n';
+                xmlContent += '</Pane>\n';
+                xmlContent += '</Panes>\n';
+                xmlContent += '<ProtectObjects>False</ProtectObjects>\n';
+                xmlContent += '<ProtectScenarios>False</ProtectScenarios>\n';
+                xmlContent += '</WorksheetOptions>\n';
+                xmlContent += '</Worksheet>\n';
+                xmlContent += '</Workbook>';
+                
+                // XML escape helper function
+                function escapeXml(str) {
+                    if (!str) return '';
+                    return str.toString().replace(/[<>&'"]/g, function (c) {
+                        switch (c) {
+                            case '<': return '&lt;';
+                            case '>': return '&gt;';
+                            case '&': return '&amp;';
+                            case "'": return '&apos;';
+                            case '"': return '&quot;';
+                            default: return c;
+                        }
+                    });
+                }
+                
+                // Create and download file
+                const BOM = '\uFEFF'; // UTF-8 BOM for Turkish characters
+                const blob = new Blob([BOM + xmlContent], { 
+                    type: 'application/vnd.ms-excel;charset=utf-8' 
+                });
+                
+                const now = new Date();
+                const dateStr = now.toISOString().slice(0, 10);
+                const timeStr = now.toTimeString().slice(0, 5).replace(':', '');
+                const filename = `teias_eklim_logs_${dateStr}_${timeStr}.xls`;
+                
+                const url = URL.createObjectURL(blob);
+                const a = document.createElement('a');
+                a.href = url;
+                a.download = filename;
+                a.style.display = 'none';
+                
+                document.body.appendChild(a);
+                a.click();
+                document.body.removeChild(a);
+                URL.revokeObjectURL(url);
+                
+                showMessage(`✅ ${logsToExport.length} log kaydı renkli Excel formatında dışa aktarıldı`, 'success');
+                
+            } catch (error) {
+                console.error('Excel export hatası:', error);
+                showMessage('❌ Excel dışa aktarma sırasında hata oluştu: ' + error.message, 'error');
+            }
+        });
+    }
+
+    // Logları temizle
+    if (clearLogsBtn) {
+        clearLogsBtn.addEventListener('click', async () => {
+            if (!confirm("Tüm log kayıtlarını silmek istediğinizden emin misiniz?\n\nBu işlem geri alınamaz ve tüm log geçmişi silinecektir.")) {
+                return;
+            }
+            
+            try {
+                const response = await secureFetch('/api/logs/clear', { method: 'POST' });
+                if (response && response.ok) {
+                    allLogs = [];
+                    filteredLogs = [];
+                    
+                    logContainer.innerHTML = `
+                        <div class="empty-state">
+                            <div class="empty-icon">✨</div>
+                            <h4>Loglar temizlendi</h4>
+                            <p>Yeni log kayıtları bekleniyor...</p>
+                        </div>
+                    `;
+                    
+                    updateLogStats();
+                    updateFilterBadges();
+                    
+                    showMessage('✅ Tüm log kayıtları başarıyla temizlendi', 'success');
+                } else {
+                    showMessage('Log temizleme başarısız oldu', 'error');
+                }
+            } catch (error) {
+                console.error('Log temizleme hatası:', error);
+                showMessage('Log temizleme sırasında hata oluştu', 'error');
+            }
+        });
+    }
+
+    // Otomatik kaydırma toggle
+    if (autoScrollToggle) {
+        autoScrollToggle.addEventListener('click', () => {
+            autoScrollActive = !autoScrollActive;
+            
+            autoScrollToggle.setAttribute('data-active', autoScrollActive.toString());
+            autoScrollToggle.classList.toggle('active', autoScrollActive);
+            
+            const toggleIcon = autoScrollToggle.querySelector('.toggle-icon');
+            const toggleText = autoScrollToggle.querySelector('.toggle-text');
+            
+            if (autoScrollActive) {
+                toggleIcon.textContent = '📜';
+                toggleText.textContent = 'Otomatik Kaydırma';
+                showMessage('Otomatik kaydırma aktif', 'info');
+                
+                // Hemen aşağı kaydır
+                setTimeout(() => {
+                    logContainer.scrollTop = logContainer.scrollHeight;
+                }, 100);
+            } else {
+                toggleIcon.textContent = '✋';
+                toggleText.textContent = 'Manuel Kaydırma';
+                showMessage('Manuel kaydırma aktif', 'info');
+            }
+        });
+    }
+
+    // Otomatik yenileme toggle
+    if (autoRefreshToggle) {
+        autoRefreshToggle.addEventListener('click', () => {
+            autoRefreshActive = !autoRefreshActive;
+            
+            autoRefreshToggle.setAttribute('data-active', autoRefreshActive.toString());
+            autoRefreshToggle.classList.toggle('active', autoRefreshActive);
+            
+            const toggleIcon = autoRefreshToggle.querySelector('.toggle-icon');
+            const toggleText = autoRefreshToggle.querySelector('.toggle-text');
+            
+            if (autoRefreshActive) {
+                toggleIcon.textContent = '🔄';
+                toggleText.textContent = 'Otomatik Yenileme';
+                showMessage('Otomatik yenileme aktif', 'info');
+                
+                // Interval'i yeniden başlat
+                const interval = parseInt(refreshInterval?.value || '5000');
+                setRefreshInterval(interval);
+            } else {
+                toggleIcon.textContent = '⏸️';
+                toggleText.textContent = 'Manuel Yenileme';
+                showMessage('Otomatik yenileme durduruldu', 'info');
+                
+                // Interval'i durdur
+                setRefreshInterval(0);
+            }
+        });
+    }
+
+    // Yenileme aralığı değişimi
+    if (refreshInterval) {
+        refreshInterval.addEventListener('change', () => {
+            if (autoRefreshActive) {
+                const interval = parseInt(refreshInterval.value);
+                setRefreshInterval(interval);
+                
+                const intervalText = refreshInterval.options[refreshInterval.selectedIndex].text;
+                showMessage(`Yenileme aralığı ${intervalText} olarak ayarlandı`, 'info');
+            }
+        });
+    }
+
+    // BAŞLATMA
+
+    // İlk logları yükle
+    fetchLogs();
+
+    // Canlı loglar: en yeni başta, sunucu halkası gibi en fazla 50 kayıt
+    onServerEvent('log', (entry) => {
+        if (state.logPaused || !autoRefreshActive) return;
+        allLogs.unshift(entry);
+        if (allLogs.length > 50) allLogs.pop();
+        updateSourceFilter();
+        applyFilters();
+    });
+    
+    // Otomatik yenileme başlat
+    const initialInterval = parseInt(refreshInterval?.value || '5000');
+    setRefreshInterval(initialInterval);
+    
+    // Cleanup - sayfa değiştiğinde
+    window.addEventListener('beforeunload', () => {
+        if (refreshIntervalId) {
+            clearInterval(refreshIntervalId);
+        }
+    });
+    
+    console.log('✅ Log filtreleme sistemi hazır');
+}
+
+    App.registerPage('log', initLogPage);
+})(window.App);
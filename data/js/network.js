@@ -0,0 +1,358 @@
+// js/network.js - Ağ ayarları sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { secureFetch, showMessage, updateElement } = App;
+
+// Network Ayarları Sayfası - GELİŞTİRİLMİŞ VERSİYON
+function initNetworkPage() {
+    console.log("🌐 Network sayfası başlatılıyor...");
+    
+    const form = document.getElementById('networkForm');
+    const dhcpRadio = document.getElementById('dhcp');
+    const staticRadio = document.getElementById('static');
+    const staticSettings = document.getElementById('staticSettings');
+    const refreshNetworkBtn = document.getElementById('refreshNetworkBtn');
+    
+    if (!form) {
+        console.error('❌ Network form bulunamadı!');
+        return;
+    }
+    
+    // Mevcut network durumunu yükle
+    loadNetworkStatus();
+    
+    // DHCP/Static toggle event listeners
+    if (dhcpRadio) {
+        dhcpRadio.addEventListener('change', function() {
+            if (this.checked && staticSettings) {
+                staticSettings.style.display = 'none';
+                console.log('📡 DHCP modu seçildi');
+                clearStaticFields();
+            }
+        });
+    }
+    
+    if (staticRadio) {
+        staticRadio.addEventListener('change', function() {
+            if (this.checked && staticSettings) {
+                staticSettings.style.display = 'block';
+                console.log('🔧 Static IP modu seçildi');
+            }
+        });
+    }
+    
+    // IP validation helper
+    function validateIPAddress(ip) {
+        const ipRegex = /^(?:(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.){3}(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$/;
+        return ipRegex.test(ip);
+    }
+    
+    // Static alanları temizle
+    function clearStaticFields() {
+        const fields = ['staticIP', 'gateway', 'subnet', 'dns1', 'dns2'];
+        fields.forEach(fieldId => {
+            const field = document.getElementById(fieldId);
+            if (field) field.value = '';
+        });
+    }
+    
+    // Real-time IP validation
+    const ipInputs = ['staticIP', 'gateway', 'subnet', 'dns1', 'dns2'];
+    ipInputs.forEach(inputId => {
+        const input = document.getElementById(inputId);
+        if (input) {
+            input.addEventListener('blur', function() {
+                if (this.value && !validateIPAddress(this.value)) {
+                    this.style.borderColor = 'var(--error)';
+                    this.style.backgroundColor = 'rgba(245, 101, 101, 0.1)';
+                    showMessage(`Geçersiz IP adresi: ${this.value}`, 'error');
+                } else {
+                    this.style.borderColor = '';
+                    this.style.backgroundColor = '';
+                }
+            });
+            
+            // Enter tuşu ile sonraki alana geç
+            input.addEventListener('keypress', function(e) {
+                if (e.key === 'Enter') {
+                    e.preventDefault();
+                    const currentIndex = ipInputs.indexOf(inputId);
+                    if (currentIndex < ipInputs.length - 1) {
+                        const nextInput = document.getElementById(ipInputs[currentIndex + 1]);
+                        if (nextInput) nextInput.focus();
+                    } else {
+                        // Son alan, form submit
+                        form.dispatchEvent(new Event('submit'));
+                    }
+                }
+            });
+        }
+    });
+    
+    // Form validation
+    function validateNetworkForm() {
+        if (staticRadio && staticRadio.checked) {
+            const requiredFields = ['staticIP', 'gateway', 'subnet', 'dns1'];
+            
+            for (const fieldId of requiredFields) {
+                const field = document.getElementById(fieldId);
+                if (!field || !field.value.trim()) {
+                    showMessage(`${fieldId} alanı zorunludur`, 'error');
+                    if (field) {
+                        field.style.borderColor = 'var(--error)';
+                        field.focus();
+                    }
+                    return false;
+                }
+                
+                if (!validateIPAddress(field.value.trim())) {
+                    showMessage(`Geçersiz IP adresi: ${field.value}`, 'error');
+                    field.style.borderColor = 'var(--error)';
+                    field.focus();
+                    return false;
+                }
+            }
+            
+            // DNS2 opsiyonel ama girilmişse valid olmalı
+            const dns2 = document.getElementById('dns2');
+            if (dns2 && dns2.value.trim() && !validateIPAddress(dns2.value.trim())) {
+                showMessage(`Geçersiz DNS2 adresi: ${dns2.value}`, 'error');
+                dns2.style.borderColor = 'var(--error)';
+                dns2.focus();
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    // Form gönderim handler'ı
+    form.addEventListener('submit', async function(e) {
+        e.preventDefault();
+        
+        if (!validateNetworkForm()) {
+            return;
+        }
+        
+        const saveBtn = document.getElementById('saveNetworkBtn');
+        const btnText = saveBtn?.querySelector('.btn-text');
+        const btnLoader = saveBtn?.querySelector('.btn-loader');
+        
+        // Loading state
+        if (saveBtn) saveBtn.disabled = true;
+        if (btnText) btnText.style.display = 'none';
+        if (btnLoader) btnLoader.style.display = 'inline-block';
+        
+        const formData = new FormData(form);
+        
+        // Debug: Form verilerini logla
+        console.log('📤 Network form verileri gönderiliyor...');
+        for (let [key, value] of formData.entries()) {
+            console.log(`${key}: ${value}`);
+        }
+        
+        try {
+            const response = await secureFetch('/api/network', {
+                method: 'POST',
+                body: new URLSearchParams(formData)
+            });
+            
+            if (response && response.ok) {
+                const result = await response.json();
+                showMessage(result.message || 'Network ayarları kaydedildi! Cihaz yeniden başlatılıyor...', 'success');
+                
+                // Countdown timer göster
+                let countdown = 10;
+                const countdownInterval = setInterval(() => {
+                    showMessage(`Cihaz ${countdown} saniye içinde yeniden başlatılıyor...`, 'warning');
+                    countdown--;
+                    
+                    if (countdown < 0) {
+                        clearInterval(countdownInterval);
+                        // Yeni IP ile yönlendirme
+                        const newIP = formData.get('staticIP');
+                        if (newIP) {
+                            window.location.href = `http://${newIP}`;
+                        } else {
+                            window.location.href = '/';
+                        }
+                    }
+                }, 1000);
+                
+            } else {
+                const errorText = response ? await response.text() : 'Ağ hatası';
+                showMessage('Network ayarları kaydedilemedi: ' + errorText, 'error');
+            }
+        } catch (error) {
+            console.error('❌ Network kayıt hatası:', error);
+            showMessage('Network ayarları kaydedilirken bir hata oluştu', 'error');
+        } finally {
+            // Reset loading state
+            if (saveBtn) saveBtn.disabled = false;
+            if (btnText) btnText.style.display = 'inline';
+            if (btnLoader) btnLoader.style.display = 'none';
+        }
+    });
+    
+    // Yenile butonu
+    if (refreshNetworkBtn) {
+        refreshNetworkBtn.addEventListener('click', function() {
+            showMessage('Sayfa yenileniyor...', 'info');
+            setTimeout(() => {
+                location.reload();
+            }, 500);
+        });
+    }
+    
+    // Network test butonu (eğer varsa)
+    const networkTestBtn = document.getElementById('networkTestBtn');
+    if (networkTestBtn) {
+        networkTestBtn.addEventListener('click', async function() {
+            showMessage('Network bağlantısı test ediliyor...', 'info');
+            
+            try {
+                const response = await secureFetch('/api/network');
+                if (response && response.ok) {
+                    const data = await response.json();
+                    if (data.linkUp) {
+                        showMessage('✅ Network bağlantısı başarılı', 'success');
+                    } else {
+                        showMessage('❌ Network bağlantısı yok', 'error');
+                    }
+                }
+            } catch (error) {
+                showMessage('Network testi başarısız', 'error');
+            }
+        });
+    }
+    
+    // Preset butonları ekle
+    setTimeout(() => {
+        addNetworkPresets();
+    }, 1000);
+    
+    console.log('✅ Network sayfası hazır');
+}
+
+// Network durumu yükleme fonksiyonu
+async function loadNetworkStatus() {
+    try {
+        console.log('🔄 Network durumu yükleniyor...');
+        
+        const response = await secureFetch('/api/network');
+        if (response && response.ok) {
+            const data = await response.json();
+            console.log('📊 Network verisi alındı:', data);
+            
+            // Durum göstergelerini güncelle
+            updateElement('ethStatus', data.linkUp ? 'Bağlı' : 'Bağlı Değil');
+            updateElement('currentIP', data.ip || 'Bilinmiyor');
+            updateElement('macAddress', data.mac || 'Bilinmiyor');
+            updateElement('linkSpeed', (data.linkSpeed || 0) + ' Mbps');
+            updateElement('currentGateway', data.gateway || 'Bilinmiyor');
+            updateElement('currentDNS', data.dns1 || 'Bilinmiyor');
+            
+            // Status badge rengini güncelle
+            const ethStatusEl = document.getElementById('ethStatus');
+            if (ethStatusEl) {
+                ethStatusEl.className = `status-value ${data.linkUp ? 'online' : 'offline'}`;
+            }
+            
+            // Form değerlerini doldur
+            const dhcpRadio = document.getElementById('dhcp');
+            const staticRadio = document.getElementById('static');
+            const staticSettings = document.getElementById('staticSettings');
+            
+            if (data.dhcp && dhcpRadio) {
+                dhcpRadio.checked = true;
+                if (staticSettings) staticSettings.style.display = 'none';
+                console.log('📡 DHCP modu aktif');
+            } else if (staticRadio) {
+                staticRadio.checked = true;
+                if (staticSettings) staticSettings.style.display = 'block';
+                
+                // Static IP değerlerini doldur
+                updateElement('staticIP', data.ip);
+                updateElement('gateway', data.gateway);
+                updateElement('subnet', data.subnet);
+                updateElement('dns1', data.dns1);
+                updateElement('dns2', data.dns2 || '');
+                
+                console.log('🔧 Static IP modu aktif');
+            }
+            
+        } else {
+            console.error('❌ Network durumu alınamadı');
+            showMessage('Network bilgileri yüklenemedi', 'error');
+        }
+    } catch (error) {
+        console.error('❌ Network durumu yükleme hatası:', error);
+        showMessage('Network durumu yüklenirken hata oluştu', 'error');
+    }
+}
+
+// Network preset butonları ekle
+function addNetworkPresets() {
+    const staticSettings = document.getElementById('staticSettings');
+    if (!staticSettings || staticSettings.querySelector('.network-presets')) return;
+    
+    const presetsHTML = `
+        <div class="network-presets" style="margin: 1rem 0; padding: 1rem; background: var(--bg-secondary); border-radius: var(--radius-md); border: 1px solid var(--border-primary);">
+            <h4 style="margin-bottom: 0.5rem; color: var(--text-primary); font-size: 0.875rem;">🚀 Hızlı IP Ayarları</h4>
+            <div style="display: flex; flex-wrap: wrap; gap: 0.5rem;">
+                <button type="button" class="preset-network-btn" data-ip="192.168.1.100" data-gw="192.168.1.1" data-subnet="255.255.255.0" data-dns="8.8.8.8">
+                    🏠 Ev Ağı (192.168.1.x)
+                </button>
+                <button type="button" class="preset-network-btn" data-ip="192.168.0.100" data-gw="192.168.0.1" data-subnet="255.255.255.0" data-dns="1.1.1.1">
+                    🏢 Ofis Ağı (192.168.0.x)
+                </button>
+                <button type="button" class="preset-network-btn" data-ip="10.0.0.100" data-gw="10.0.0.1" data-subnet="255.255.255.0" data-dns="8.8.4.4">
+                    🏭 Kurumsal (10.0.0.x)
+                </button>
+            </div>
+        </div>
+    `;
+    
+    staticSettings.insertAdjacentHTML('beforeend', presetsHTML);
+    
+    // Event listeners ekle
+    staticSettings.querySelectorAll('.preset-network-btn').forEach(btn => {
+        btn.style.cssText = `
+            padding: 0.25rem 0.5rem;
+            background: linear-gradient(135deg, var(--bg-tertiary), var(--bg-secondary));
+            border: 1px solid var(--border-primary);
+            border-radius: var(--radius-full);
+            color: var(--text-secondary);
+            font-size: 0.75rem;
+            cursor: pointer;
+            transition: all var(--transition-fast);
+        `;
+        
+        btn.addEventListener('mouseover', function() {
+            this.style.background = 'linear-gradient(135deg, var(--primary), var(--secondary))';
+            this.style.color = 'white';
+        });
+        
+        btn.addEventListener('mouseout', function() {
+            this.style.background = 'linear-gradient(135deg, var(--bg-tertiary), var(--bg-secondary))';
+            this.style.color = 'var(--text-secondary)';
+        });
+        
+        btn.addEventListener('click', function() {
+            const ip = this.dataset.ip;
+            const gw = this.dataset.gw;
+            const subnet = this.dataset.subnet;
+            const dns = this.dataset.dns;
+            
+            // Değerleri doldur
+            updateElement('staticIP', ip);
+            updateElement('gateway', gw);
+            updateElement('subnet', subnet);
+            updateElement('dns1', dns);
+            
+            showMessage(`✅ ${this.textContent.trim()} ayarları yüklendi`, 'success');
+        });
+    });
+}
+
+    App.registerPage('network', initNetworkPage);
+})(window.App);
@@ -0,0 +1,497 @@
+// js/ntp.js - NTP ayarları sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { state, secureFetch, showMessage, updateElement } = App;
+
+    // Klavye navigasyonu için
+document.addEventListener('keydown', function(e) {
+    if (e.target.classList.contains('ip-part')) {
+        // Backspace ile geri gitme
+        if (e.key === 'Backspace' && e.target.value === '') {
+            const part = parseInt(e.target.dataset.part);
+            if (part > 1) {
+                const prevInput = e.target.parentElement.querySelector(`.ip-part[data-part="${part - 1}"]`);
+                if (prevInput) {
+                    prevInput.focus();
+                    prevInput.select();
+                }
+            }
+        }
+        // Sol ok ile geri gitme
+        else if (e.key === 'ArrowLeft' && e.target.selectionStart === 0) {
+            const part = parseInt(e.target.dataset.part);
+            if (part > 1) {
+                const prevInput = e.target.parentElement.querySelector(`.ip-part[data-part="${part - 1}"]`);
+                if (prevInput) {
+                    prevInput.focus();
+                    prevInput.select();
+                }
+            }
+        }
+        // Sağ ok ile ileri gitme
+        else if (e.key === 'ArrowRight' && e.target.selectionStart === e.target.value.length) {
+            const part = parseInt(e.target.dataset.part);
+            if (part < 4) {
+                const nextInput = e.target.parentElement.querySelector(`.ip-part[data-part="${part + 1}"]`);
+                if (nextInput) {
+                    nextInput.focus();
+                    nextInput.select();
+                }
+            }
+        }
+    }
+});
+
+    // NTP Ayarları
+    // Global fonksiyon - window nesnesine ekle ki HTML'den çağrılabilsin
+window.moveToNext = function(input, nextPart, isSecondary = false) {
+    const value = input.value;
+    
+    // Sadece sayı girişine izin ver ve temizle
+    const numericValue = value.replace(/[^0-9]/g, '');
+    input.value = numericValue;
+    
+    // 255'i aşmasını engelle
+    if (parseInt(numericValue) > 255) {
+        input.value = '255';
+    }
+    
+    // Otomatik geçiş koşulları
+    const shouldMoveNext = (input.value.length === 3) || 
+                          (input.value === '255') || 
+                          (input.value.length === 2 && parseInt(input.value) > 25);
+    
+    if (shouldMoveNext && nextPart <= 4) {
+        const nextInput = getNextIPInput(input, nextPart, isSecondary);
+        if (nextInput) {
+            setTimeout(() => {
+                nextInput.focus();
+                nextInput.select();
+            }, 10);
+        }
+    }
+    
+    // Hidden input'u güncelle
+    updateHiddenIPInput(isSecondary);
+    
+    // Container'ı validate et
+    validateIPContainer(input.closest('.ip-input-container'));
+};
+
+function getNextIPInput(currentInput, nextPart, isSecondary) {
+    if (isSecondary) {
+        return document.getElementById(`ntp2-part${nextPart}`);
+    } else {
+        const container = currentInput.closest('.ip-input-container');
+        return container ? container.querySelector(`.ip-part[data-part="${nextPart}"]`) : null;
+    }
+}
+
+function getPrevIPInput(currentInput, currentPart, isSecondary) {
+    if (currentPart <= 1) return null;
+    
+    if (isSecondary) {
+        return document.getElementById(`ntp2-part${currentPart - 1}`);
+    } else {
+        const container = currentInput.closest('.ip-input-container');
+        return container ? container.querySelector(`.ip-part[data-part="${currentPart - 1}"]`) : null;
+    }
+}
+
+function updateHiddenIPInput(isSecondary = false) {
+    const hiddenId = isSecondary ? 'ntpServer2' : 'ntpServer1';
+    const hiddenInput = document.getElementById(hiddenId);
+    
+    if (!hiddenInput) return;
+    
+    let parts = [];
+    
+    if (isSecondary) {
+        // İkincil NTP için ID'leri kullan
+        for (let i = 1; i <= 4; i++) {
+            const input = document.getElementById(`ntp2-part${i}`);
+            const value = input ? (input.value || '0') : '0';
+            parts.push(value);
+        }
+    } else {
+        // Birincil NTP için container'dan seç
+        const container = document.querySelector('.ip-input-container:not(:has(#ntp2-part1))');
+        if (container) {
+            const inputs = container.querySelectorAll('.ip-part');
+            inputs.forEach(input => {
+                const value = input.value || '0';
+                parts.push(value);
+            });
+        } else {
+            parts = ['0', '0', '0', '0'];
+        }
+    }
+    
+    const ip = parts.join('.');
+    hiddenInput.value = ip;
+    
+    console.log(`${isSecondary ? 'NTP2' : 'NTP1'} güncellendi:`, ip);
+}
+
+function validateIPContainer(container) {
+    if (!container) return false;
+    
+    const inputs = container.querySelectorAll('.ip-part');
+    let isValid = true;
+    let isEmpty = true;
+    
+    inputs.forEach(input => {
+        const value = input.value.trim();
+        if (value !== '' && value !== '0') {
+            isEmpty = false;
+        }
+        
+        if (value !== '') {
+            const num = parseInt(value);
+            if (isNaN(num) || num < 0 || num > 255) {
+                isValid = false;
+            }
+        }
+    });
+    
+    // CSS class'larını güncelle
+    container.classList.remove('valid', 'invalid', 'empty');
+    
+    if (isEmpty) {
+        container.classList.add('empty');
+        return false;
+    } else if (isValid) {
+        container.classList.add('valid');
+        return true;
+    } else {
+        container.classList.add('invalid');
+        return false;
+    }
+}
+
+function validateIPFormat(ip) {
+    if (!ip || ip.trim() === '' || ip === '0.0.0.0') return false;
+    
+    const parts = ip.split('.');
+    if (parts.length !== 4) return false;
+    
+    return parts.every(part => {
+        const num = parseInt(part);
+        return !isNaN(num) && num >= 0 && num <= 255 && part === num.toString();
+    });
+}
+
+function validateNTPForm() {
+    const ntp1 = document.getElementById('ntpServer1').value;
+    const ntp2 = document.getElementById('ntpServer2').value;
+    
+    console.log('NTP Form Validation:', { ntp1, ntp2 });
+    
+    // Birincil NTP zorunlu kontrol
+    if (!validateIPFormat(ntp1)) {
+        showMessage('Lütfen geçerli bir birincil NTP IP adresi girin. Örnek: 192.168.1.1', 'error');
+        
+        // İlk container'a focus et
+        const firstContainer = document.querySelector('.ip-input-container:not(:has(#ntp2-part1))');
+        if (firstContainer) {
+            const firstInput = firstContainer.querySelector('.ip-part');
+            if (firstInput) firstInput.focus();
+            firstContainer.classList.add('invalid');
+        }
+        return false;
+    }
+    
+    // İkincil NTP opsiyonel ama girilmişse geçerli olmalı
+    if (ntp2 && ntp2 !== '0.0.0.0' && !validateIPFormat(ntp2)) {
+        showMessage('İkincil NTP IP adresi geçersiz. Boş bırakabilir veya geçerli IP girebilirsiniz.', 'error');
+        
+        // İkinci container'a focus et
+        const secondContainer = document.querySelector('.ip-input-container:has(#ntp2-part1)');
+        if (secondContainer) {
+            const firstInput = secondContainer.querySelector('.ip-part');
+            if (firstInput) firstInput.focus();
+            secondContainer.classList.add('invalid');
+        }
+        return false;
+    }
+    
+    return true;
+}
+
+function loadCurrentNTPToInputs(server1, server2) {
+    console.log('NTP değerleri yükleniyor:', { server1, server2 });
+    
+    // Birincil NTP yükle
+    if (server1 && validateIPFormat(server1)) {
+        const parts = server1.split('.');
+        const container = document.querySelector('.ip-input-container:not(:has(#ntp2-part1))');
+        if (container) {
+            const inputs = container.querySelectorAll('.ip-part');
+            parts.forEach((part, index) => {
+                if (inputs[index]) {
+                    inputs[index].value = part;
+                }
+            });
+            updateHiddenIPInput(false);
+            validateIPContainer(container);
+        }
+    }
+    
+    // İkincil NTP yükle
+    if (server2 && validateIPFormat(server2)) {
+        const parts = server2.split('.');
+        for (let i = 1; i <= 4; i++) {
+            const input = document.getElementById(`ntp2-part${i}`);
+            if (input && parts[i-1]) {
+                input.value = parts[i-1];
+            }
+        }
+        updateHiddenIPInput(true);
+        const container2 = document.querySelector('.ip-input-container:has(#ntp2-part1)');
+        validateIPContainer(container2);
+    }
+}
+
+function setupIPInputKeyboardHandlers() {
+    document.addEventListener('keydown', function(e) {
+        if (!e.target.classList.contains('ip-part')) return;
+        
+        const currentInput = e.target;
+        const currentPart = parseInt(currentInput.dataset.part);
+        const isSecondary = currentInput.id && currentInput.id.startsWith('ntp2-');
+        
+        switch(e.key) {
+            case 'Backspace':
+                if (currentInput.value === '' && currentInput.selectionStart === 0) {
+                    e.preventDefault();
+                    const prevInput = getPrevIPInput(currentInput, currentPart, isSecondary);
+                    if (prevInput) {
+                        prevInput.focus();
+                        prevInput.setSelectionRange(prevInput.value.length, prevInput.value.length);
+                    }
+                }
+                break;
+                
+            case 'ArrowLeft':
+                if (currentInput.selectionStart === 0) {
+                    e.preventDefault();
+                    const prevInput = getPrevIPInput(currentInput, currentPart, isSecondary);
+                    if (prevInput) {
+                        prevInput.focus();
+                        prevInput.setSelectionRange(prevInput.value.length, prevInput.value.length);
+                    }
+                }
+                break;
+                
+            case 'ArrowRight':
+                if (currentInput.selectionStart === currentInput.value.length) {
+                    e.preventDefault();
+                    const nextInput = getNextIPInput(currentInput, currentPart + 1, isSecondary);
+                    if (nextInput) {
+                        nextInput.focus();
+                        nextInput.setSelectionRange(0, 0);
+                    }
+                }
+                break;
+                
+            case '.':
+            case 'Period':
+                e.preventDefault();
+                const nextInput = getNextIPInput(currentInput, currentPart + 1, isSecondary);
+                if (nextInput) {
+                    nextInput.focus();
+                    nextInput.select();
+                }
+                break;
+                
+            case 'Tab':
+                // Tab normal davranışını korur, müdahale etme
+                break;
+                
+            default:
+                // Sadece sayısal girişe izin ver
+                if (!/[0-9]/.test(e.key) && 
+                    !['Backspace', 'Delete', 'Tab', 'ArrowLeft', 'ArrowRight', 'Home', 'End'].includes(e.key) &&
+                    !e.ctrlKey && !e.metaKey) {
+                    e.preventDefault();
+                }
+        }
+    });
+    
+    // Input change olayları
+    document.addEventListener('input', function(e) {
+        if (e.target.classList.contains('ip-part')) {
+            const isSecondary = e.target.id && e.target.id.startsWith('ntp2-');
+            
+            // Değeri güncelle
+            setTimeout(() => {
+                updateHiddenIPInput(isSecondary);
+                validateIPContainer(e.target.closest('.ip-input-container'));
+            }, 10);
+        }
+    });
+}
+
+function addPresetServerButtons() {
+    const form = document.getElementById('ntpForm');
+    if (!form) return;
+    
+    const firstSection = form.querySelector('.settings-section');
+    if (!firstSection || firstSection.querySelector('.preset-servers')) return; // Zaten eklenmişse çık
+    
+    const presetHTML = `
+        <div class="preset-servers">
+            <h4>🚀 Hızlı NTP Sunucu Seçenekleri</h4>
+            <div class="preset-buttons">
+                <button type="button" class="preset-btn" data-ip="192.168.1.1" title="Yerel Router/Modem">
+                    🏠 Router (192.168.1.1)
+                </button>
+                <button type="button" class="preset-btn" data-ip="8.8.8.8" title="Google Public DNS">
+                    🌐 Google (8.8.8.8)
+                </button>
+                <button type="button" class="preset-btn" data-ip="1.1.1.1" title="Cloudflare DNS">
+                    ⚡ Cloudflare (1.1.1.1)
+                </button>
+                <button type="button" class="preset-btn" data-ip="208.67.222.222" title="OpenDNS">
+                    🔒 OpenDNS (208.67.222.222)
+                </button>
+            </div>
+        </div>
+    `;
+    
+    firstSection.insertAdjacentHTML('beforeend', presetHTML);
+    
+    // Event listener'ları ekle
+    form.querySelectorAll('.preset-btn').forEach(btn => {
+        btn.addEventListener('click', function() {
+            const ip = this.dataset.ip;
+            const parts = ip.split('.');
+            
+            // Birincil NTP'ye yükle
+            const container = document.querySelector('.ip-input-container:not(:has(#ntp2-part1))');
+            if (container) {
+                const inputs = container.querySelectorAll('.ip-part');
+                parts.forEach((part, index) => {
+                    if (inputs[index]) {
+                        inputs[index].value = part;
+                        
+                        // Güzel bir animasyon efekti
+                        inputs[index].style.background = 'rgba(72, 187, 120, 0.3)';
+                        setTimeout(() => {
+                            inputs[index].style.background = '';
+                        }, 500);
+                    }
+                });
+                
+                updateHiddenIPInput(false);
+                validateIPContainer(container);
+                
+                showMessage(`✅ Birincil NTP sunucu: ${ip} seçildi`, 'success');
+            }
+        });
+    });
+}
+
+// İyileştirilmiş initNtpPage fonksiyonu
+function initNtpPage() {
+    const form = document.getElementById('ntpForm');
+    if (!form) {
+        console.warn('NTP form bulunamadı');
+        return;
+    }
+    
+    console.log('NTP sayfası başlatılıyor...');
+    
+    // Klavye handler'larını kur
+    setupIPInputKeyboardHandlers();
+    
+    // Preset butonları ekle
+    setTimeout(() => addPresetServerButtons(), 100);
+    
+    // Mevcut ayarları yükle
+    secureFetch('/api/ntp')
+        .then(r => r && r.json())
+        .then(ntp => {
+            if (ntp) {
+                console.log('Mevcut NTP ayarları:', ntp);
+                
+                updateElement('currentServer1', ntp.ntpServer1 || 'Belirtilmemiş');
+                updateElement('currentServer2', ntp.ntpServer2 || 'Belirtilmemiş');
+                updateElement('lastUpdate', new Date().toLocaleTimeString());
+                
+                // IP inputlarına yükle
+                setTimeout(() => {
+                    loadCurrentNTPToInputs(ntp.ntpServer1, ntp.ntpServer2);
+                }, 200);
+            }
+        })
+        .catch(error => {
+            console.error('NTP ayarları yüklenemedi:', error);
+            showMessage('NTP ayarları yüklenirken hata oluştu', 'error');
+        });
+
+    // Form gönderim handler'ı
+    form.addEventListener('submit', async (e) => {
+        e.preventDefault();
+        
+        console.log('NTP formu gönderiliyor...');
+        
+        // Validation
+        if (!validateNTPForm()) {
+            return;
+        }
+        
+        const saveBtn = document.getElementById('saveNtpBtn');
+        const btnText = saveBtn.querySelector('.btn-text');
+        const btnLoader = saveBtn.querySelector('.btn-loader');
+        
+        // Loading state
+        saveBtn.disabled = true;
+        btnText.style.display = 'none';
+        btnLoader.style.display = 'inline-block';
+        
+        const formData = new FormData(form);
+        const server1 = formData.get('ntpServer1');
+        const server2 = formData.get('ntpServer2');
+        
+        console.log('Gönderilecek NTP ayarları:', { server1, server2 });
+        
+        try {
+            const response = await secureFetch('/api/ntp', {
+                method: 'POST',
+                body: new URLSearchParams(formData)
+            });
+            
+            if (response && response.ok) {
+                showMessage('✅ NTP ayarları başarıyla dsPIC33EP\'ye gönderildi', 'success');
+                
+                // Mevcut değerleri göster
+                updateElement('currentServer1', server1);
+                updateElement('currentServer2', server2 || 'Belirtilmemiş');
+                updateElement('lastUpdate', new Date().toLocaleTimeString());
+                
+            } else {
+                const errorText = await response.text();
+                showMessage('❌ NTP ayarları gönderilemedi: ' + errorText, 'error');
+            }
+        } catch (error) {
+            console.error('NTP API hatası:', error);
+            showMessage('⚠️ Sunucu ile iletişim kurulamadı', 'error');
+        } finally {
+            // Reset loading state
+            saveBtn.disabled = false;
+            btnText.style.display = 'inline';
+            btnLoader.style.display = 'none';
+        }
+    });
+    
+    // Sayfa yüklendiğinde hidden input'ları başlat
+    setTimeout(() => {
+        updateHiddenIPInput(false);
+        updateHiddenIPInput(true);
+    }, 300);
+    
+    console.log('✅ NTP sayfası hazır');
+}
+
+    App.registerPage('ntp', initNtpPage);
+})(window.App);
@@ -0,0 +1,99 @@
+// js/systeminfo.js - Sistem bilgisi sayfası; loadPage() ilk ziyarette yükler
+(function (App) {
+    const { state, secureFetch, showMessage, updateElement, serverEvents, onServerEvent, formatBytes, formatUptime } = App;
+
+    // System Info Sayfası - YENİ
+    function initSystemInfoPage() {
+        const updateSystemInfo = async () => {
+            try {
+                const response = await secureFetch('/api/system-info');
+                if (response && response.ok) {
+                    const data = await response.json();
+                    
+                    // Hardware bilgileri
+                    updateElement('chipModel', data.hardware.chip);
+                    updateElement('coreCount', data.hardware.cores);
+                    updateElement('cpuFreq', data.hardware.frequency + ' MHz');
+                    updateElement('chipRevision', data.hardware.revision);
+                    updateElement('flashSize', formatBytes(data.hardware.flashSize));
+                    
+                    // Memory bilgileri
+                    updateElement('totalHeap', formatBytes(data.memory.totalHeap));
+                    updateElement('usedHeap', formatBytes(data.memory.usedHeap));
+                    updateElement('freeHeap', formatBytes(data.memory.freeHeap));
+                    updateElement('minFreeHeap', formatBytes(data.memory.minFreeHeap));
+                    
+                    const usagePercent = Math.round((data.memory.usedHeap / data.memory.totalHeap) * 100);
+                    updateElement('ramUsageBar', '', usagePercent);
+                    updateElement('ramUsagePercent', usagePercent + '%');
+                    document.getElementById('ramUsageBar').style.width = usagePercent + '%';
+                    
+                    // Software bilgileri
+                    updateElement('firmwareVersion', 'v' + data.software.version);
+                    updateElement('sdkVersion', data.software.sdk);
+                    updateElement('buildDate', data.software.buildDate);
+                    updateElement('uptime', formatUptime(data.software.uptime));
+                    
+                    // UART istatistikleri
+                    updateElement('uartTxCount', data.uart.txCount);
+                    updateElement('uartRxCount', data.uart.rxCount);
+                    updateElement('uartErrorCount', data.uart.errors);
+                    updateElement('uartSuccessRate', data.uart.successRate.toFixed(1) + '%');
+                    updateElement('currentBaud', data.uart.baudRate);
+                    
+                    // Dosya sistemi
+                    updateElement('totalSpace', formatBytes(data.filesystem.total));
+                    updateElement('usedSpace', formatBytes(data.filesystem.used));
+                    updateElement('freeSpace', formatBytes(data.filesystem.free));
+                }
+            } catch (error) {
+                console.error('System info hatası:', error);
+                showMessage('Sistem bilgileri alınamadı', 'error');
+            }
+        };
+
+        // Değişken alanlar /api/events 'system' olayıyla gelir
+        const applySystemEvent = () => {
+            const s = serverEvents.snapshot.system;
+            const totalHeap = s.usedHeap + s.freeHeap;
+            updateElement('usedHeap', formatBytes(s.usedHeap));
+            updateElement('freeHeap', formatBytes(s.freeHeap));
+            updateElement('minFreeHeap', formatBytes(s.minFreeHeap));
+            if (totalHeap > 0) {
+                const usagePercent = Math.round((s.usedHeap / totalHeap) * 100);
+                updateElement('ramUsagePercent', usagePercent + '%');
+                const bar = document.getElementById('ramUsageBar');
+                if (bar) bar.style.width = usagePercent + '%';
+            }
+            updateElement('uptime', formatUptime(s.uptime));
+            updateElement('uartTxCount', s.txCount);
+            updateElement('uartRxCount', s.rxCount);
+            updateElement('uartErrorCount', s.errors);
+            updateElement('uartSuccessRate', Number(s.successRate).toFixed(1) + '%');
+        };
+
+        updateSystemInfo();
+        onServerEvent('system', applySystemEvent);
+        state.pollingIntervals.systemInfo = setInterval(() => {
+            if (!serverEvents.connected) updateSystemInfo();
+        }, 10000);
+
+        // Yenile butonu
+        document.getElementById('refreshBtn')?.addEventListener('click', updateSystemInfo);
+
+        // Yeniden başlat butonu
+        document.getElementById('rebootBtn')?.addEventListener('click', async () => {
+            if (confirm('Sistemi yeniden başlatmak istediğinize emin misiniz?')) {
+                const response = await secureFetch('/api/system/reboot', { method: 'POST' });
+                if (response && response.ok) {
+                    showMessage('Sistem yeniden başlatılıyor...', 'warning');
+                    setTimeout(() => {
+                        window.location.href = '/';
+                    }, 3000);
+                }
+            }
+        });
+    }
+
+    App.registerPage('systeminfo', initSystemInfoPage);
+})(window.App);
@@ -0,0 +1,48 @@
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#include <Arduino.h>
+
+// Heap'e duyarlı kabul kontrolü: rota handler'ı çalışmadan önce en büyük ayrılabilir
+// blok (ESP.getMaxAllocHeap) rotanın tahmini geçici heap ihtiyacıyla karşılaştırılır.
+// Parçalanmış heap'te JsonDocument/String ayrımı handler'ın ortasında başarısız olur;
+// bunun yerine pahalı istek baştan kısa bir 503 + Retry-After alır.
+// En alttaki ADMISSION_RESERVE_BYTES yalnızca ROUTE_FLAG_RESERVED rotalara açıktır: giriş
+// sayfası ve /login, panel kabuğu (/, style.css, script.js), gösterge paneli parçası ve
+// modülü ile /api/status. Bellek sıkışsa da operatör giriş yapıp durumu görebilir; diğer
+// sayfalar ve başlıktaki cihaz bilgisi/bildirimler 503 alır (arayüz bunları atlar).
+// Aynı pay UART ve log alt sistemlerinin String ayrımlarına da yer bırakır.
+// Yalnız webServerTask'tan çağrılır (admissionAllow); admissionDegraded her task'tan.
+#define ADMISSION_RESERVE_BYTES  (12 * 1024)
+#define ADMISSION_DEGRADE_BYTES  (32 * 1024)   // Bunun altında isteğe bağlı özellikler kısılır
+#define ADMISSION_RETRY_AFTER    2             // sn
+
+// Tablo dışı istekler için tahmin (KB): önek kuralları (statik parçalar) ve WebServer
+// listesi (dosya yükleme / geri yükleme JSON'u, 404)
+#define ADMISSION_PREFIX_KB      2
+#define ADMISSION_FALLBACK_KB    8
+
+// Kısıtlı modda küçültülen sayfalar
+#define ADMISSION_DEGRADED_FAULT_PAGE  5      // /api/faults/parsed?action=range (normalde 20)
+
+struct AdmissionStats {
+    unsigned long admitted;
+    unsigned long rejected;          // 503 - handler çalışmadı
+    unsigned long reservedAdmitted;  // Yalnızca yedek pay sayesinde kabul edilen
+    unsigned long degraded;          // Kısıtlı modda kabul edilen
+    unsigned long sheddingEpisodes;  // Reddetmeye başlanan dönem sayısı
+    uint32_t minLargestBlock;        // Kabul sırasında görülen en küçük blok
+};
+
+extern AdmissionStats admissionStats;
+
+// İsteği kabul et ya da reddet; reserved rotalar yedek payı da kullanabilir
+bool admissionAllow(uint16_t heapKB, bool reserved);
+
+// Bellek sıkışık: handler'lar pretty print, büyük sayfa, gzip gibi isteğe bağlı işleri kısar
+bool admissionDegraded();
+
+// Şu an reddedilen dönemde mi (metrikler)
+bool admissionShedding();
+
+#endif // ADMISSION_H
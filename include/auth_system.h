@@ -8,6 +8,8 @@ void handleUserLogin();
 void handleUserLogout();
 void refreshSession();
 bool isTokenValid(const String& token); 
+bool touchSession(const String& token);
+String requestToken();
 
 #endif
 
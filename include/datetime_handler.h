@@ -2,6 +2,7 @@
 #define DATETIME_HANDLER_H
 
 #include <Arduino.h>
+#include "uart_scheduler.h"
 
 // DateTime işleme yapısı
 struct DateTimeData {
@@ -12,8 +13,11 @@ struct DateTimeData {
     bool isValid;
 };
 
-// Global datetime verisi
-extern DateTimeData datetimeData;
+// datetimeData ve komut geçmişini uartTask (önbellek yenileme), UART worker'ı ve web task'ı
+// paylaşır; String alanlar yalnızca kilit altında kopyalanarak okunur.
+void initDateTimeHandler();
+void getDateTimeSnapshot(DateTimeData& out);
+unsigned long getDateTimeLastUpdate();   // Geçerli değer yoksa 0
 
 // Komut geçmişi yapısı
 struct CommandHistory {
@@ -24,14 +28,14 @@ struct CommandHistory {
 };
 
 // Fonksiyon tanımlamaları
-bool requestDateTimeFromDsPIC();
+bool requestDateTimeFromDsPIC(UARTPriority priority = UART_PRIO_NORMAL);
 bool parseeDateTimeResponse(const String& response);
-bool setDateTimeToDsPIC(const String& date, const String& time);
+bool setDateTimeToDsPIC(const String& date, const String& time, UARTPriority priority = UART_PRIO_NORMAL);
 String formatDateCommand(const String& date);
 String formatTimeCommand(const String& time);
 bool validateDateTime(const String& date, const String& time);
 String getCurrentESP32DateTime();
-bool syncWithESP32Time();
+bool syncWithESP32Time(UARTPriority priority = UART_PRIO_NORMAL);
 void addCommandToHistory(const String& command, bool success, const String& response);
 String getCommandHistoryJSON();
 
@@ -0,0 +1,53 @@
+#ifndef DSPIC_CACHE_H
+#define DSPIC_CACHE_H
+
+#include <Arduino.h>
+#include "uart_scheduler.h"
+
+// dsPIC'ten okunan değerler için bayat-iken-yenile (stale-while-revalidate) önbelleği.
+// Taze değer hemen döner; TTL geçmişse eski değer döner ve uartTask arka planda yeniler.
+// Hiç değer yoksa ilk istek UART'a senkron gider.
+enum DsPICCacheItem {
+    DSPIC_CACHE_FAULT_COUNT = 0,   // AN komutu
+    DSPIC_CACHE_DATETIME = 1,      // DN komutu (datetimeData)
+    DSPIC_CACHE_LINK_HEALTH = 2    // TEST komutu
+};
+
+#define DSPIC_CACHE_ITEMS 3
+
+// Öğe başına tazelik süreleri (ms)
+#define FAULT_COUNT_CACHE_TTL  10000
+#define DATETIME_CACHE_TTL     5000
+#define LINK_HEALTH_CACHE_TTL  30000
+
+// Öğe başına önbellek sayaçları
+struct DsPICCacheStats {
+    unsigned long hits;             // Taze değer döndü
+    unsigned long staleHits;        // Bayat değer döndü, yenileme istendi
+    unsigned long misses;           // Değer yoktu, UART'a senkron gidildi
+    unsigned long refreshes;        // Başarılı arka plan yenilemesi
+    unsigned long refreshFailures;  // Başarısız arka plan yenilemesi
+};
+
+extern DsPICCacheStats dspicCacheStats[DSPIC_CACHE_ITEMS];
+
+void initDsPICCache();
+
+// Handler tarafı: değer varsa true döner. forceRefresh ile önbellek atlanır.
+bool getCachedFaultCount(int& count, UARTPriority priority, UARTCancelToken* cancel, bool forceRefresh = false);
+bool getCachedDateTime(UARTPriority priority, UARTCancelToken* cancel, bool forceRefresh = false);
+bool getCachedLinkHealth(bool& success, String& response, UARTPriority priority,
+                         UARTCancelToken* cancel, bool forceRefresh = false);
+
+// Değer var mı (bayat da olsa), yaşı (ms) ve TTL'i geçip geçmediği
+bool dspicCacheHasValue(DsPICCacheItem item);
+unsigned long dspicCacheAge(DsPICCacheItem item);
+bool dspicCacheIsStale(DsPICCacheItem item);
+void dspicCacheInvalidate(DsPICCacheItem item);
+
+// uartTask'tan çağrılır: bekleyen yenilemelerden birini BACKGROUND önceliğiyle yapar
+void processDsPICCacheRefresh();
+
+const char* dspicCacheItemName(DsPICCacheItem item);
+
+#endif // DSPIC_CACHE_H
@@ -0,0 +1,42 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <Arduino.h>
+
+// /api/events - Server-Sent Events. Panel her biri ayrı HTTP isteği olan status/system/
+// bildirim/log sorguları yerine tek açık bağlantıdan değişiklikleri alır.
+//   event: status         Gösterge paneli alanları (yalnız değişenler)
+//   event: system         Sistem sayfasının değişken alanları (yalnız değişenler)
+//   event: log            Yeni log kaydı, id: log sıra numarası
+//   event: notifications  Uyarı/hata sayısı değişti
+//   event: auth           Oturum bitti - istemci bağlantıyı kapatıp giriş sayfasına döner
+// EventSource başlık gönderemediği için jeton ?token= ile gelir. Yeniden bağlanan istemci
+// Last-Event-ID ile kaçırdığı logları alır.
+#define SSE_MAX_CLIENTS         3
+#define SSE_STATUS_INTERVAL     1000    // ms - status alanları bu aralıkla karşılaştırılır
+#define SSE_SYSTEM_INTERVAL     5000    // ms - system alanları
+#define SSE_HEARTBEAT_INTERVAL  15000   // ms - boşta yorum satırı + oturum kontrolü
+#define SSE_RETRY_MS            3000    // İstemcinin yeniden bağlanma gecikmesi
+#define SSE_MAX_LOGS_PER_TICK   10      // Bir turda gönderilen en fazla log
+
+struct EventStreamStats {
+    unsigned long connects;
+    unsigned long rejected;        // Geçersiz jeton
+    unsigned long evicted;         // Havuz dolu - en eski istemci kapatıldı
+    unsigned long dropped;         // Yazma hatası / istemci ayrıldı
+    unsigned long events;          // Gönderilen olay (tüm istemciler)
+    unsigned long heartbeats;
+    unsigned long replayedLogs;    // Last-Event-ID ile yeniden gönderilen
+};
+
+extern EventStreamStats eventStreamStats;
+
+// GET /api/events handler'ı
+void handleEventStream();
+
+// webServerTask'tan her turda çağrılır (istemci yoksa hemen döner)
+void processEventStream();
+
+int eventStreamClientCount();
+
+#endif // EVENT_STREAM_H
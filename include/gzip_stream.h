@@ -0,0 +1,77 @@
+#ifndef GZIP_STREAM_H
+#define GZIP_STREAM_H
+
+#include <Arduino.h>
+
+// Büyük dinamik yanıtlar için akışlı gzip (RFC 1951/1952) kodlayıcısı.
+// zlib/miniz'in 32 KB pencere + dinamik Huffman tabloları (~45 KB) yerine küçük, sabit
+// bir geçmiş tamponu ve sabit Huffman blokları (BTYPE=01) kullanır; JSON anahtarları gibi
+// kısa aralıklarla tekrarlanan metinde yeterli kazanç sağlar. Kodlayıcı yalnızca yanıt
+// sıkıştırılacaksa yığından ayrılır.
+#define GZIP_HISTORY_BITS 10                          // Eşleşme aranan geçmiş (1 KB)
+#define GZIP_HISTORY_SIZE (1 << GZIP_HISTORY_BITS)
+#define GZIP_BUFFER_SIZE  (2 * GZIP_HISTORY_SIZE)     // Geçmiş + işlenmeyi bekleyen girdi
+#define GZIP_HASH_BITS    9                           // 3 baytlık önek özetleri
+#define GZIP_OUTPUT_SIZE  512                         // Bir chunked parça olarak yazılan sıkıştırılmış bayt
+
+// Sıkıştırılmış baytların gideceği yer (ör. chunked yanıt yazıcısı)
+typedef void (*GzipSink)(void* context, const uint8_t* data, size_t length);
+
+struct GzipStats {
+    unsigned long responses;       // Sıkıştırılarak gönderilen yanıt
+    unsigned long skipped;         // Eşiği aştı ama istemci gzip kabul etmiyor / bellek yok
+    unsigned long long inBytes;    // Sıkıştırma öncesi gövde
+    unsigned long long outBytes;   // gzip çıktısı (başlık ve trailer dahil)
+    unsigned long long cycles;     // Kodlayıcıda harcanan CPU çevrimi
+    uint32_t maxCycles;            // Tek yanıttaki en uzun kodlama
+};
+
+extern GzipStats gzipStats;
+
+class GzipEncoder {
+public:
+    GzipEncoder(GzipSink sink, void* context);
+
+    // İlk çağrıda gzip başlığını da yazar
+    void write(const uint8_t* data, size_t length);
+
+    // Kalan girdiyi kodlar, son bloğu ve trailer'ı (CRC32, boyut) yazar
+    void finish();
+
+    uint32_t inBytes() const { return _inBytes; }
+    uint32_t outBytes() const { return _outBytes; }
+    uint32_t cycles() const { return _cycles; }
+
+private:
+    void compress(bool final);
+    void slide();
+    void putBits(uint32_t value, uint8_t count);
+    void putCode(uint16_t code, uint8_t length);
+    void putLiteral(uint8_t value);
+    void putMatch(uint16_t length, uint16_t distance);
+    void putByte(uint8_t value);
+    void flushOutput();
+
+    GzipSink _sink;
+    void* _context;
+    bool _started;
+    uint32_t _crc;
+    uint32_t _inBytes;
+    uint32_t _outBytes;
+    uint32_t _cycles;
+
+    uint8_t _window[GZIP_BUFFER_SIZE];
+    size_t _length;                           // Tampondaki bayt
+    size_t _pos;                              // Bundan öncesi kodlandı
+    uint16_t _head[1 << GZIP_HASH_BITS];      // Özetin son görüldüğü konum + 1 (0 = yok)
+
+    uint32_t _bitBuffer;
+    uint8_t _bitCount;
+    uint8_t _output[GZIP_OUTPUT_SIZE];
+    size_t _outputUsed;
+};
+
+// Accept-Encoding başlığı gzip'i kabul ediyor mu ("gzip;q=0" reddetmektir)
+bool acceptsGzipEncoding(const String& acceptEncoding);
+
+#endif // GZIP_STREAM_H
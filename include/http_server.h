@@ -0,0 +1,295 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <ArduinoJson.h>
+#include "uart_scheduler.h"
+#include "route_table.h"
+#include "route_metrics.h"
+
+// Ertelenmiş yanıtlar: UART'a bağlı handler isteği bir worker task'a devreder ve hemen döner.
+// Sunucu sıradaki istemciye geçer (statik dosyalar, /api/status, önbellekli değerler beklemez);
+// worker UART işini bitirince yanıtı doğrudan soketine yazar ve bağlantıyı kapatır.
+#define DEFERRED_QUEUE_LENGTH 8
+#define DEFERRED_MAX_ARGS     8
+#define DEFERRED_TASK_STACK   8192
+
+// Kalıcı bağlantılar (HTTP/1.1 keep-alive): panel 5-30 sn'de bir sorgu atar, her birinde yeni
+// TCP kurulumu ve TIME_WAIT lwIP'ye pahalıya gelir. Bağlantılar küçük bir havuzda boşta bekletilir.
+#define KEEPALIVE_MAX_CONNECTIONS 4      // Aynı anda açık tutulan istemci soketi
+#define KEEPALIVE_IDLE_TIMEOUT    5000   // ms - boşta bağlantının kapatılma süresi (0 = kapalı)
+#define KEEPALIVE_MAX_REQUESTS    100    // Bağlantı başına en fazla istek
+#define KEEPALIVE_PIPELINE_DEPTH  4      // Bir turda aynı bağlantıdan işlenen ardışık istek
+
+// Hız sınırına takılan istemcinin okunmamış başlık/gövdesi boşaltılmadan kapatılırsa lwIP
+// RST gönderir ve 429 istemciye ulaşmaz. Yazma yönü kapatılıp kısa ve sınırlı okunur.
+#define REJECT_DRAIN_TIMEOUT      50     // ms
+#define REJECT_DRAIN_BYTES        2048
+
+// JSON yanıtları String'e değil bu boyutta bir tampona serileştirilir; tampon dolunca
+// chunked parça olarak gönderilir. Tampona sığan yanıt tek parça, Content-Length ile gider.
+// Tampona sığmayan yanıtlar istemci kabul ediyorsa gzip ile sıkıştırılır (gzip_stream.h):
+// küçük yanıtlarda başlık + trailer (18 B) ve kodlayıcı belleği kazançtan fazladır.
+#define JSON_STREAM_BUFFER 512
+
+// WebServer durum satırı + başlıkları ve gövdeyi ayrı yazar, chunked parçayı da üç yazımda
+// (boyut, veri, CRLF) gönderir; Nagle ile ikinci segment istemcinin gecikmeli ACK'ini bekler.
+// Bu boyuta kadar gövdeler başlıklarla tek tamponda birleştirilip tek yazımla gönderilir.
+#define RESPONSE_COALESCE_MAX 1024
+
+// Tüm yanıtlara eklenen güvenlik başlıkları (addSecurityHeaders ve ertelenmiş yanıtlar)
+#define SECURITY_HEADER_COUNT 5
+extern const char* const securityHeaders[SECURITY_HEADER_COUNT][2];
+
+struct DeferredRequest;
+typedef void (*DeferredHandler)(DeferredRequest& request);
+
+// Handler dönerken alınan istek anlık görüntüsü - worker server.arg() kullanamaz
+struct DeferredRequest {
+    WiFiClient client;              // Soketin kendi referansı; sunucu bırakınca da açık kalır
+    String uri;
+    String argNames[DEFERRED_MAX_ARGS];
+    String argValues[DEFERRED_MAX_ARGS];
+    int argCount;
+    UARTCancelToken cancel;         // İstemci koparsa/süre dolarsa UART işi bırakılır
+    DeferredHandler handler;
+    unsigned long queuedAt;
+    bool responded;
+    size_t metricsSlot;             // Rota metrik yuvası
+    unsigned long startUs;          // İsteğin web task'ında başladığı an
+    int status;                     // Yazılan yanıt kodu (0 = yazılmadı)
+    size_t bytesSent;
+    bool acceptsGzip;               // Accept-Encoding: gzip
+    uint32_t writes;                // Sokete yazma çağrısı
+    bool inlineReply;               // completeInline: yanıt normal (keep-alive) yoldan yazılır
+
+    String arg(const char* name) const;
+    bool hasArg(const char* name) const;
+};
+
+struct DeferredStats {
+    unsigned long queued;
+    unsigned long completed;
+    unsigned long inlineCompleted;  // Önbellekten hemen yanıtlanan
+    unsigned long rejected;         // Kuyruk dolu - 503
+    unsigned long abandoned;        // Yanıt yazılmadan kapanan (istemci ayrıldı)
+    unsigned long maxQueueWaitMs;
+};
+
+// Sayaçları web task'ı ve worker ayrı çekirdeklerden yazar; okuma kilit altında kopyadır
+void getDeferredStats(DeferredStats& out);
+
+struct JsonStreamStats {
+    unsigned long single;        // Tampona sığdı - Content-Length ile
+    unsigned long chunked;       // Parça parça gönderildi
+    unsigned long chunks;        // Toplam parça
+    unsigned long maxBytes;      // En büyük yanıt gövdesi
+};
+
+extern JsonStreamStats jsonStreamStats;
+
+// Bağlantı yeniden kullanım sayaçları
+struct KeepAliveStats {
+    unsigned long connections;        // Kabul edilen TCP bağlantısı
+    unsigned long requests;           // İşlenen toplam istek
+    unsigned long reusedRequests;     // Açık bağlantı üzerinden gelen (ilk istek hariç)
+    unsigned long pipelined;          // Önceki yanıt yazılırken tamponda bekleyen istek
+    unsigned long closedIdle;         // Boşta süre doldu
+    unsigned long closedMaxRequests;  // İstek sınırına ulaştı
+    unsigned long closedByClient;     // İstemci kapattı
+    unsigned long closedByServer;     // Connection: close, HTTP/1.0, uzunluğu belirsiz yanıt
+    unsigned long evicted;            // Havuz dolu - en eski boşta bağlantı kapatıldı
+    unsigned long handedOff;          // Ertelenen/ham yanıtla worker'a devredilen
+    unsigned long open;               // Şu an havuzdaki bağlantı
+};
+
+extern KeepAliveStats keepAliveStats;
+
+class AppWebServer;
+class GzipEncoder;
+
+// /api/batch: alt isteğin yanıtı sokete değil buraya yazılır
+#define BATCH_MAX_PATHS 8
+#define BATCH_MAX_BYTES 12288    // Yakalanan gövdelerin toplamı; aşılınca kalan yollar çalıştırılmaz
+
+struct CapturedResponse {
+    int status;       // 0 = handler yanıt yazmadı
+    bool json;        // Content-Type: application/json
+    String body;
+    size_t limit;     // Gövde sınırı (0 = sınırsız); aşan yanıt saklanmaz
+    bool truncated;   // Sınır aşıldı - body boş bırakıldı
+};
+
+// ArduinoJson'un doğrudan yazdığı Print: yanıt boyutundan bağımsız sabit ek bellek.
+// İstek web task'ında (server) ya da ertelenmiş olarak worker'da (request) yanıtlanır.
+class JsonResponseStream : public Print {
+public:
+    JsonResponseStream(AppWebServer& server, int code, const char* contentType);
+    JsonResponseStream(AppWebServer& server, DeferredRequest& request, int code, const char* contentType);
+    ~JsonResponseStream();
+
+    virtual size_t write(uint8_t c) override;
+    virtual size_t write(const uint8_t* data, size_t length) override;
+
+    // Kalan tamponu ve son parçayı gönderir; gönderilen gövde boyutunu döner
+    size_t end();
+
+private:
+    void flushChunk();
+    void writeHeader(bool chunked, size_t length);
+    void writeBody(const uint8_t* data, size_t length);
+    void writeSingle();
+    static void gzipSink(void* context, const uint8_t* data, size_t length);
+
+    AppWebServer& _server;
+    DeferredRequest* _request;
+    int _code;
+    const char* _contentType;
+    bool _headerSent;
+    bool _chunked;
+    size_t _used;
+    size_t _total;
+    uint8_t _buffer[JSON_STREAM_BUFFER];
+    bool _gzipAllowed;
+    GzipEncoder* _gzip;       // Yalnızca sıkıştırılan yanıtta ayrılır
+};
+
+class AppWebServer : public WebServer {
+public:
+    AppWebServer(int port);
+
+    virtual void begin() override;
+    virtual void handleClient() override;
+
+    // Özetli rota tablosu. Tabloda olmayan istekler server.on() listesine düşer
+    // (dosya yükleme handler'ı ve onNotFound). Tablolar statik ömürlü olmalı.
+    void setRoutes(const Route* routes, size_t count, const RoutePrefix* prefixes, size_t prefixCount);
+    const Route* findRoute(HTTPMethod method, const char* path) const;
+    RouteBenchResult benchmarkRoutes(uint32_t rounds);
+
+    // Rota metrik yuvaları (route_metrics.h): tablo, önek kuralları, son yuva WebServer listesi
+    size_t routeSlotCount() const { return _routeCount + _prefixCount + 1; }
+    const char* routeSlotPath(size_t slot, HTTPMethod& method) const;
+
+    // Rotayı mevcut istek bağlamında (oturum) çalıştırıp yanıtını yakalar. Handler dış
+    // isteğin argümanlarını değil yalnızca query'den ("a=1&b=2") ayrıştırılanları görür.
+    // Yalnızca ROUTE_FLAG_BATCH rotalar için: handler ertelememeli ve soketi devralmamalı.
+    void runCaptured(const Route& route, const String& query, CapturedResponse& out);
+    bool capturing() const { return _capture != NULL; }
+
+    // Çağıran oturumu zaten doğruladı: sıradaki runCaptured() boyunca checkSession()
+    // oturuma tekrar bakmaz. Bayrak alt istek bitince temizlenir.
+    void markAuthenticated() { _captureAuthenticated = true; }
+    bool captureAuthenticated() const { return _capture != NULL && _captureAuthenticated; }
+
+    // Kalıcı bağlantı ayarı - idleMs 0 ise her yanıttan sonra bağlantı kapatılır
+    void setKeepAlive(unsigned long idleMs, uint16_t maxRequests);
+    unsigned long keepAliveIdleTimeout() const { return _idleTimeoutMs; }
+    uint16_t keepAliveMaxRequests() const { return _maxRequests; }
+
+    // Mevcut isteği UART worker'ına devret. Kuyruk doluysa 503 gönderir ve false döner.
+    bool deferRequest(DeferredHandler handler, unsigned long budgetMs);
+
+    // Aynı handler'ı beklemeden web task'ında çalıştır (değer önbellekteyse). Yanıt sunucunun
+    // kendi yolundan yazılır; bağlantı havuzda kalır, arkasındaki istekler de yanıtlanır.
+    void completeInline(DeferredHandler handler);
+
+    // Mevcut soketi sunucudan al (uzun ömürlü akışlar için); yanıtı çağıran yazar
+    WiFiClient detachClient();
+
+    // Ertelenmiş isteğin yanıtını ham HTTP olarak yaz ve bağlantıyı kapat
+    void sendDeferred(DeferredRequest& request, int code, const char* contentType, const String& content);
+
+    // Jeton iptal olduysa true döner. İstemci ayrıldıysa yanıt yazılmaz; süre dolmuş ama
+    // istemci hâlâ bağlıysa 504 JSON hatası gönderilir (bekleyen istemci boş yanıt almaz).
+    bool deferredCancelled(DeferredRequest& request);
+
+    // JSON belgesini ara String olmadan gönder
+    void sendJson(int code, const JsonDocument& doc);
+    void sendDeferredJson(DeferredRequest& request, int code, const JsonDocument& doc);
+
+    // Durum satırı, başlıklar ve gövde tek yazımda (gövde RESPONSE_COALESCE_MAX'ı aşmıyorsa).
+    // send() ve send_P() buraya yönlenir; sendContent() chunked parçayı tek yazımda çerçeveler.
+    void sendCoalesced(int code, const char* contentType, const char* content, size_t length);
+
+    // securityHeaders'ı sıradaki yanıta ekler (zaten eklenmişse tekrarlamaz)
+    void sendSecurityHeaders();
+    void send(int code, const char* content_type = NULL, const String& content = String(""));
+    void send(int code, char* content_type, const String& content);
+    void send(int code, const String& content_type, const String& content);
+    void send(int code, const char* content_type, const char* content);
+    using WebServer::send_P;
+    void send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
+    void sendContent(const String& content);
+    void sendContent(const char* content, size_t contentLength);
+
+    // Ertelenmiş yanıt başlığı - length yerine chunked ise Transfer-Encoding: chunked
+    String deferredHeader(int code, const char* contentType, bool chunked, size_t length, bool gzip = false);
+
+    // Mevcut isteğin Accept-Encoding başlığı gzip'i kabul ediyor mu
+    bool requestAcceptsGzip();
+
+protected:
+    // Yanıt başlığındaki "Connection: close" satırını keep-alive ile değiştirir
+    virtual size_t _currentClientWrite(const char* b, size_t l) override;
+
+private:
+    struct KeepAliveSlot {
+        WiFiClient client;
+        unsigned long lastActivity;
+        uint16_t requests;
+        bool active;
+    };
+
+    void fillRequest(DeferredRequest& request, DeferredHandler handler, unsigned long budgetMs);
+    void acceptClient();
+    void serveSlot(KeepAliveSlot& slot);
+    void closeSlot(KeepAliveSlot& slot, unsigned long& reason);
+    bool requestWantsKeepAlive();
+    void dispatchRoute();
+    bool rejectRateLimited(RateClass rateClass);
+    void sendRateLimited(uint32_t retryAfter);
+    RateClass rateClassFor(HTTPMethod method, const String& uri) const;
+
+    // Handler listesinin başındaki kapı (http_server.cpp): _parseRequest istek satırını
+    // okuyup handler ararken çağrılır - başlıklar ve gövde okunmadan kova kontrol edilir
+    class RateGate;
+    void gateRequest(HTTPMethod method, const String& uri);
+    bool rejectLowMemory(uint16_t heapKB, bool reserved);
+
+    KeepAliveSlot _slots[KEEPALIVE_MAX_CONNECTIONS];
+    unsigned long _idleTimeoutMs;
+    uint16_t _maxRequests;
+    bool _detachCurrent;
+    bool _headerPending;      // Bu isteğin ilk yazımı henüz yapılmadı (başlık)
+    bool _keepAliveAllowed;   // İstemci ve sınırlar bağlantıyı açık tutmaya izin veriyor
+    bool _responseKeepAlive;  // Başlık keep-alive olarak yazıldı
+    uint16_t _remainingRequests;
+    bool _rateChecked;        // Bu isteğin jetonu istek satırında harcandı
+    bool _rateLimited;        // Kova boştu - gövde okunmadan 429
+    uint32_t _retryAfter;
+
+    const Route* _routes;
+    size_t _routeCount;
+    const RoutePrefix* _prefixes;
+    size_t _prefixCount;
+    uint8_t _routeIndex[ROUTE_INDEX_SLOTS];   // rota sırası + 1, 0 = boş
+
+    // Handler'ı saran zamanlayıcı (http_server.cpp) ve okuduğu yanıt sayaçları
+    class RouteTimer;
+    int _responseStatus;      // Başlıktan okunan kod (0 = çağıran yazdı ya da devretti)
+    size_t _responseBytes;
+    uint32_t _responseWrites;
+    bool _countBody;          // Content-Length yoksa gövde yazımları sayılır
+    bool _metricsDeferred;    // İstek worker'a devredildi - kaydı worker yapar
+    size_t _metricsSlot;
+    unsigned long _requestStartUs;
+
+    CapturedResponse* _capture;   // runCaptured() sırasında yazımların hedefi
+    bool _captureAuthenticated;   // markAuthenticated(): alt istek oturum kontrolünü atlar
+};
+
+void initDeferredResponses();
+
+#endif // HTTP_SERVER_H
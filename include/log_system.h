@@ -22,11 +22,17 @@ struct LogEntry {
 extern LogEntry logs[50];
 extern int logIndex;
 extern int totalLogs;
+extern unsigned long logSequence;   // Açılıştan beri eklenen log sayısı (SSE olay kimliği)
 
 void initLogSystem();
 void addLog(const String& msg, LogLevel level, const String& source);
 String logLevelToString(LogLevel level);
 void clearLogs();
+// Web ve UART task'ları aynı anda log yazar/okur - logs[] erişimi bu kilitle yapılır
+void lockLogs();
+void unlockLogs();
+// Sıra numarasıyla kayıt - halkadan düştüyse ya da temizlendiyse false
+bool getLogBySequence(unsigned long seq, LogEntry& out);
 String getFormattedTimestamp();
 String getFormattedTimestampFallback();
 
@@ -0,0 +1,47 @@
+#ifndef RATE_LIMITER_H
+#define RATE_LIMITER_H
+
+#include <Arduino.h>
+
+// İstemci başına token bucket: her IP'nin her rota sınıfı için ayrı kovası vardır.
+// Bir istemcinin trafiği başka istemciyi kısmaz; kovası boşalan istemci istek satırından
+// sonra, başlıkları ve gövdesi okunmadan kısa bir 429 alır ve bağlantısı kapatılır.
+// Yalnız webServerTask'tan çağrılır (kilit yok).
+enum RateClass {
+    RATE_API = 0,      // Okuma/yazma API'leri (varsayılan)
+    RATE_STATIC = 1,   // HTML/JS/CSS ve /pages/ parçaları
+    RATE_UART = 2      // dsPIC'e giden istekler (UART worker'ı, konsol)
+};
+
+#define RATE_CLASS_COUNT 3
+
+// İstemci tablosu: sabit boyut, IP özetiyle açık adresleme. Aday pencerede boş yuva
+// yoksa en uzun süredir görülmeyen istemci çıkarılır (yaklaşık LRU, sınırlı maliyet).
+#define RATE_LIMIT_TABLE_BITS 5
+#define RATE_LIMIT_TABLE_SIZE (1 << RATE_LIMIT_TABLE_BITS)   // 32 istemci
+#define RATE_LIMIT_PROBE      8     // Bir IP için bakılan en fazla yuva
+
+struct RateClassConfig {
+    const char* name;
+    uint16_t burst;        // Kova kapasitesi (istek)
+    uint16_t perSecond;    // Dolum hızı (istek/sn)
+};
+
+extern const RateClassConfig rateClassConfig[RATE_CLASS_COUNT];
+
+struct RateLimitStats {
+    unsigned long allowed[RATE_CLASS_COUNT];
+    unsigned long rejected[RATE_CLASS_COUNT];
+    unsigned long evicted;         // Tablo dolu - en eski istemci çıkarıldı
+    unsigned long tracked;         // Tablodaki istemci
+};
+
+extern RateLimitStats rateLimitStats;
+
+// İsteğe izin ver ya da reddet. Reddedilirse retryAfterSec kovada bir isteklik
+// yer açılmasına kalan süredir (en az 1).
+bool rateLimitAllow(uint32_t ip, RateClass rateClass, uint32_t& retryAfterSec);
+
+const char* rateClassName(RateClass rateClass);
+
+#endif // RATE_LIMITER_H
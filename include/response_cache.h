@@ -0,0 +1,57 @@
+#ifndef RESPONSE_CACHE_H
+#define RESPONSE_CACHE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Pahalı ve salt okunur API yanıtları için serileştirilmiş gövde önbelleği.
+// Taze gövde JsonDocument kurulmadan olduğu gibi gönderilir. Gövde TTL dolunca,
+// bağlı durum alanının sürümü değişince ya da açıkça geçersiz kılınınca yeniden üretilir.
+enum ResponseCacheItem {
+    RESPONSE_CACHE_DEVICE_INFO = 0,   // /api/device-info (ağ durumuna bağlı)
+    RESPONSE_CACHE_SYSTEM_INFO = 1    // /api/system-info (LittleFS, heap, SDK)
+};
+
+#define RESPONSE_CACHE_ITEMS 2
+
+// Öğe başına tazelik süreleri (ms)
+#define DEVICE_INFO_RESPONSE_TTL  60000
+#define SYSTEM_INFO_RESPONSE_TTL  5000
+#define FILESYSTEM_USAGE_TTL      60000   // LittleFS doluluğu (system-info ve SSE paylaşır)
+
+// Öğe başına önbellek sayaçları
+struct ResponseCacheStats {
+    unsigned long hits;            // Saklı gövde gönderildi
+    unsigned long misses;          // Gövde yeniden üretildi
+    unsigned long invalidations;   // Açık geçersiz kılma ya da durum sürümü değişimi
+    size_t bytes;                  // Saklı gövde boyutu
+};
+
+extern ResponseCacheStats responseCacheStats[RESPONSE_CACHE_ITEMS];
+
+// Handler tarafı: taze gövde varsa 200 ile gönderir ve true döner.
+// Güvenlik başlıkları çağırandan önce eklenmiş olmalı.
+bool responseCacheServe(ResponseCacheItem item);
+
+// Dokümanı bir kez serileştirir, saklar ve gönderir
+void responseCacheStore(ResponseCacheItem item, const JsonDocument& doc);
+
+// Her task'tan çağrılabilir; gövde bir sonraki istekte yeniden üretilir
+void responseCacheInvalidate(ResponseCacheItem item);
+void responseCacheInvalidateAll();
+
+bool responseCacheHasValue(ResponseCacheItem item);
+unsigned long responseCacheAge(ResponseCacheItem item);
+unsigned long responseCacheTTL(ResponseCacheItem item);
+
+const char* responseCacheItemName(ResponseCacheItem item);
+
+// LittleFS.usedBytes() tüm blok tablosunu tarar; değer FILESYSTEM_USAGE_TTL boyunca
+// saklanır. Yalnızca web task'ından çağrılır (system-info ve olay akışı).
+void cachedFilesystemUsage(size_t& total, size_t& used);
+
+// Yedek/geri yükleme gibi yazmalardan sonra değeri bir sonraki çağrıda yeniden okutur.
+// RESPONSE_CACHE_SYSTEM_INFO geçersizleştirildiğinde kendiliğinden çağrılır.
+void invalidateFilesystemUsage();
+
+#endif // RESPONSE_CACHE_H
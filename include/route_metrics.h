@@ -0,0 +1,41 @@
+#ifndef ROUTE_METRICS_H
+#define ROUTE_METRICS_H
+
+#include <Arduino.h>
+
+// Rota başına istek sayacı, durum kodu sınıfları, gönderilen bayt, heap değişimi ve
+// gecikme histogramı. Yuvalar AppWebServer::setRoutes() sırasındadır: önce tablo
+// rotaları, sonra önek kuralları, en sonda WebServer listesi (yükleme, 404).
+// Web task'ı ve ertelenmiş yanıt worker'ı yazar - kayıt kritik bölgede.
+#define ROUTE_LATENCY_BUCKETS 10
+
+// Kova üst sınırları (µs); son kova sınırsız
+extern const uint32_t routeLatencyBoundsUs[ROUTE_LATENCY_BUCKETS - 1];
+
+struct RouteMetrics {
+    uint32_t requests;
+    uint32_t statusClass[5];      // 1xx..5xx; yanıtı çağıranın yazdığı akışlar (SSE, WebSocket) hariç
+    uint32_t deferred;            // Worker'da bitenler - süre kuyruk beklemesini de içerir
+    uint64_t bytesSent;           // Başlık + gövde (Content-Length ya da yazılan parçalar)
+    uint32_t writes;              // Sokete yazma çağrısı - her biri en az bir TCP segmenti
+    uint64_t totalUs;
+    uint32_t maxUs;
+    int32_t minHeapDelta;         // Handler boyunca boş heap'teki en büyük düşüş (negatif)
+    int32_t maxHeapDelta;
+    uint32_t histogram[ROUTE_LATENCY_BUCKETS];
+};
+
+// Yuva tablosunu ayırır (önceki sayaçlar silinir)
+void initRouteMetrics(size_t slots);
+size_t routeMetricsSlots();
+
+void recordRouteMetrics(size_t slot, int status, size_t bytes, uint32_t writes, uint32_t elapsedUs,
+                        int32_t heapDelta, bool deferred);
+
+// Yuvanın tutarlı kopyası; yuva yoksa false
+bool getRouteMetrics(size_t slot, RouteMetrics& out);
+
+void resetRouteMetrics();
+unsigned long routeMetricsAge();   // Son sıfırlamadan bu yana (ms)
+
+#endif // ROUTE_METRICS_H
@@ -0,0 +1,101 @@
+#ifndef ROUTE_TABLE_H
+#define ROUTE_TABLE_H
+
+#include <Arduino.h>
+#include <HTTP_Method.h>
+#include <type_traits>
+#include "rate_limiter.h"
+
+// Sabit rota tablosu: WebServer her istekte handler listesini baştan sona dolaşıp
+// String karşılaştırır (rota sayısıyla doğrusal). Burada anahtar, metot + yolun FNV-1a
+// özetidir ve derleme zamanında hesaplanır; istek yolu bir kez özetlenir, açık adresli
+// indekste birkaç adımda bulunur ve tek strcmp ile doğrulanır.
+#define ROUTE_FNV_OFFSET 2166136261u
+#define ROUTE_FNV_PRIME  16777619u
+#define ROUTE_INDEX_SLOTS 128    // 2'nin kuvveti, rota sayısının en az iki katı
+
+typedef void (*RouteHandler)();
+
+// Rota bayrakları
+#define ROUTE_FLAG_BATCH    0x01    // /api/batch içinden çağrılabilir: salt okunur, web task'ında yanıtlar
+#define ROUTE_FLAG_RESERVED 0x02    // Heap yedek payını kullanabilir (admission.h) - durum ve giriş
+
+// Kabul kontrolü için rota başına tahmini geçici heap (KB): JsonDocument, yanıt String'i,
+// ertelenmiş istek kopyası. Sınıf varsayılanları; büyük yanıtlar ROUTE_HEAVY ile verilir.
+#define ROUTE_HEAP_API_KB    4
+#define ROUTE_HEAP_STATIC_KB 2
+#define ROUTE_HEAP_UART_KB   6      // DeferredRequest + worker'daki belge
+
+// C++11 constexpr: tek return ifadesi, özyineleme
+constexpr uint32_t routeHash(const char* s, uint32_t h) {
+    return *s == '\0' ? h : routeHash(s + 1, (h ^ (uint8_t)*s) * ROUTE_FNV_PRIME);
+}
+
+constexpr uint32_t routeKey(HTTPMethod method, const char* path) {
+    return routeHash(path, (ROUTE_FNV_OFFSET ^ (uint32_t)method) * ROUTE_FNV_PRIME);
+}
+
+// Çalışma zamanı karşılığı (istek yolu için) - routeKey ile aynı değeri üretir
+inline uint32_t routeKeyOf(HTTPMethod method, const char* path) {
+    uint32_t h = (ROUTE_FNV_OFFSET ^ (uint32_t)method) * ROUTE_FNV_PRIME;
+    while (*path != '\0') {
+        h = (h ^ (uint8_t)*path++) * ROUTE_FNV_PRIME;
+    }
+    return h;
+}
+
+struct Route {
+    uint32_t key;
+    HTTPMethod method;
+    const char* path;
+    RouteHandler handler;
+    RateClass rateClass;     // İstemci başına hangi kovadan düşülür
+    uint8_t flags;           // ROUTE_FLAG_*
+    uint8_t heapKB;          // Tahmini geçici heap ihtiyacı (KB)
+};
+
+// Önek kuralı: ör. /pages/ altındaki tüm dosyalar oturum ister. guard false dönerse 401.
+struct RoutePrefix {
+    HTTPMethod method;
+    const char* prefix;
+    bool (*guard)();
+    RouteHandler handler;
+    RateClass rateClass;
+};
+
+// integral_constant anahtarı derleme zamanında hesaplatır (constexpr değilse derleme hatası)
+#define ROUTE_ENTRY(rateClass, flags, heapKB, method, path, handler) \
+    {std::integral_constant<uint32_t, routeKey(method, path)>::value, method, path, handler, rateClass, flags, heapKB}
+#define ROUTE(method, path, handler)        ROUTE_ENTRY(RATE_API, 0, ROUTE_HEAP_API_KB, method, path, handler)
+#define ROUTE_BATCH(method, path, handler)  ROUTE_ENTRY(RATE_API, ROUTE_FLAG_BATCH, ROUTE_HEAP_API_KB, method, path, handler)
+#define ROUTE_STATIC(method, path, handler) ROUTE_ENTRY(RATE_STATIC, 0, ROUTE_HEAP_STATIC_KB, method, path, handler)
+#define ROUTE_UART(method, path, handler)   ROUTE_ENTRY(RATE_UART, 0, ROUTE_HEAP_UART_KB, method, path, handler)
+#define ROUTE_HEAVY(heapKB, method, path, handler) ROUTE_ENTRY(RATE_API, 0, heapKB, method, path, handler)
+#define ROUTE_SHELL(method, path, handler)  ROUTE_ENTRY(RATE_STATIC, ROUTE_FLAG_RESERVED, ROUTE_HEAP_STATIC_KB, method, path, handler)
+
+struct RouteStats {
+    unsigned long exact;         // Tablodan bulunan
+    unsigned long prefixed;      // Önek kuralıyla
+    unsigned long fallback;      // WebServer listesine düşen (yükleme, 404)
+    unsigned long limited;       // Rate limit - handler çalışmadan 429
+    unsigned long rejected;      // Önek kuralı guard'ı reddetti
+    unsigned long duplicates;    // Kayıtta aynı metot + yol
+    uint16_t routes;
+    uint16_t maxProbe;           // İndeksteki en uzun arama zinciri
+    uint64_t totalCycles;        // Arama (özet + indeks + strcmp) çevrimleri
+    uint32_t maxCycles;
+};
+
+extern RouteStats routeStats;
+
+// Aynı rotalar için özetli arama ile WebServer tarzı doğrusal String karşılaştırmasının
+// karşılaştırması (çevrim/arama)
+struct RouteBenchResult {
+    uint16_t routes;
+    uint32_t rounds;
+    uint32_t hashedAvgCycles;
+    uint32_t linearAvgCycles;
+    uint32_t linearWorstCycles;  // Listenin sonundaki rota
+};
+
+#endif // ROUTE_TABLE_H
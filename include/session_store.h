@@ -0,0 +1,42 @@
+#ifndef SESSION_STORE_H
+#define SESSION_STORE_H
+
+#include <Arduino.h>
+
+// Oturum tablosu: aynı anda birden fazla oturum (ikinci mühendis, SCADA sorgulayıcısı)
+// birbirini düşürmeden açık kalır. Jeton özetiyle açık adresli indekste aranır
+// (oturum sayısından bağımsız), eşleşme sabit süreli karşılaştırmayla doğrulanır.
+// Her oturumun kendi son etkinlik ve bitiş zamanı vardır; tablo doluyken yeni giriş
+// en uzun süredir kullanılmayan oturumu çıkarır.
+// webServerTask, deferred worker ve konsol task'ından çağrılır - işlemler kritik bölgede.
+#define SESSION_TABLE_SIZE   12
+#define SESSION_INDEX_SLOTS  32     // 2'nin kuvveti, tablo boyutunun en az iki katı
+#define SESSION_TOKEN_LENGTH 32
+
+enum SessionResult {
+    SESSION_VALID = 0,
+    SESSION_UNKNOWN,      // Tabloda yok (hiç açılmadı, çıkış yapıldı ya da çıkarıldı)
+    SESSION_EXPIRED       // Süresi doldu - bu çağrıda tablodan silindi
+};
+
+struct SessionStats {
+    unsigned long created;
+    unsigned long evicted;     // Tablo dolu - en az kullanılan oturum çıkarıldı
+    unsigned long expired;
+    unsigned long revoked;     // Çıkış / parola değişikliği
+    unsigned long rejected;    // Bilinmeyen ya da süresi dolmuş jetonla istek
+};
+
+extern SessionStats sessionStats;
+
+// Yeni oturum aç ve jetonunu döndür
+String createSession();
+
+// Jetonu doğrula. touch: kullanıcı etkinliği - bitiş süresi SESSION_TIMEOUT kadar uzar.
+SessionResult lookupSession(const String& token, bool touch);
+
+bool revokeSession(const String& token);
+void revokeAllSessions();
+int activeSessionCount();
+
+#endif // SESSION_STORE_H
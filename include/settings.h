@@ -2,7 +2,7 @@
 #define SETTINGS_H
 
 #include <Arduino.h>
-#include <WebServer.h>
+#include "http_server.h"
 #include <ETH.h>
 
 struct Settings {
@@ -17,13 +17,11 @@ struct Settings {
     String passwordHash;
     long currentBaudRate;
     
-    // isLoggedIn yerine bu alanı kullanacağız
-    String sessionToken; 
-    unsigned long sessionStartTime;
+    // Oturumlar session_store tablosunda; bu süre her oturumun boşta kalma sınırı
     unsigned long SESSION_TIMEOUT;
 };
 
-extern WebServer server;
+extern AppWebServer server;
 extern Settings settings;
 
 void loadSettings();
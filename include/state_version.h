@@ -0,0 +1,37 @@
+#ifndef STATE_VERSION_H
+#define STATE_VERSION_H
+
+#include <Arduino.h>
+
+// Durum alanı sürüm sayaçları: alan değiştiğinde (ayar kaydı, log eklenmesi, ağ olayı)
+// sayaç artar. GET handler'ları zayıf ETag'i sayaçtan üretir, değişiklik yoksa
+// JsonDocument kurmadan 304 döner.
+enum StateDomain {
+    STATE_SETTINGS = 0,   // /api/settings
+    STATE_NETWORK = 1,    // /api/network
+    STATE_NTP = 2,        // /api/ntp
+    STATE_LOGS = 3        // /api/logs, /api/notifications
+};
+
+#define STATE_DOMAIN_COUNT 4
+
+// Alan başına koşullu GET sayaçları
+struct StateVersionStats {
+    unsigned long notModified;   // 304
+    unsigned long full;          // 200 - gövde üretildi
+};
+
+extern StateVersionStats stateVersionStats[STATE_DOMAIN_COUNT];
+
+// Açılış kimliği: yeniden başlatma sonrası sayaçlar sıfırlansa da eski ETag eşleşmez
+void initStateVersions();
+
+void bumpStateVersion(StateDomain domain);
+uint32_t getStateVersion(StateDomain domain);
+
+// W/"<alan><açılış>-<sürüm>"
+String stateETag(StateDomain domain);
+
+const char* stateDomainName(StateDomain domain);
+
+#endif // STATE_VERSION_H
@@ -0,0 +1,75 @@
+#ifndef STATIC_ASSETS_H
+#define STATIC_ASSETS_H
+
+#include <Arduino.h>
+
+// Web dosyaları derleme aşamasında (tools/build_web_assets.py) küçültülüp gzip'lenir.
+// Aynı içerik firmware'e gömülür (web_assets_data.h) ve flash'tan doğrudan gönderilir.
+// LittleFS imajında da <yol>.gz dosyaları ve /manifest.json bulunur; gömülü tablo yoksa
+// (üretici betik çalışmadan derlenmiş firmware) bunlar kullanılır.
+#define STATIC_MANIFEST_PATH  "/manifest.json"
+#define STATIC_ASSET_MAX      32
+
+// Sürümlü URL (?v=<hash>) içerik değişince değişir - tarayıcı süresiz tutabilir.
+// Sürümsüz istekler (HTML, sayfa parçaları) her seferinde ETag ile doğrulanır.
+#define STATIC_CACHE_IMMUTABLE   "public, max-age=31536000, immutable"
+#define STATIC_CACHE_REVALIDATE  "no-cache"
+
+// Üretilen tablo satırı - veri flash'ta (.rodata) kalır, RAM'e kopyalanmaz
+struct EmbeddedAsset {
+    const char* path;       // "/script.js"
+    const uint8_t* data;    // gzip içerik
+    size_t length;          // Content-Length
+    const char* etag;       // Tırnaklı güçlü ETag
+    const char* version;    // ?v= değeri
+};
+
+struct StaticAsset {
+    String path;      // "/script.js"
+    String etag;      // Tırnaklı güçlü ETag: "\"eccbe818d262cc0f\""
+    String version;   // ?v= değeri
+    size_t size;      // Sıkıştırılmış boyut
+};
+
+struct StaticAssetStats {
+    unsigned long embedded;      // 200 - flash'taki gömülü kopya gönderildi
+    unsigned long served;        // 200 - LittleFS'teki dosya gönderildi
+    unsigned long notModified;   // 304 - If-None-Match eşleşti
+    unsigned long unindexed;     // Manifestte yok, doğrulayıcısız gönderildi
+};
+
+extern StaticAssetStats staticAssetStats;
+
+// Manifesti yükler; yoksa dosyalar eskisi gibi doğrulayıcısız sunulur
+void initStaticAssets();
+const StaticAsset* findStaticAsset(const String& path);
+int staticAssetCount();
+
+// Firmware'e gömülü kopya (yoksa NULL)
+const EmbeddedAsset* findEmbeddedAsset(const String& path);
+int embeddedAssetCount();
+
+// If-None-Match başlığı ("a", "b" listesi ya da *) ETag ile eşleşiyor mu
+bool etagMatches(const String& ifNoneMatch, const String& etag);
+
+// Range: bytes=a-b | a- | -n (RFC 9110 14.1.2). Tek aralık desteklenir; çoklu aralık,
+// bilinmeyen birim ya da bozuk sözdizimi RANGE_NONE döner - tam gövde (200) gönderilir.
+enum RangeResult {
+    RANGE_NONE,            // Range yok sayılır
+    RANGE_SATISFIABLE,     // start/length dolduruldu - 206
+    RANGE_UNSATISFIABLE    // Başlangıç gövdenin dışında - 416
+};
+
+RangeResult parseByteRange(const String& header, size_t total, size_t& start, size_t& length);
+
+// Statik dosyalar ve dosya tabanlı indirmeler (UART kaydı, yedek) için sayaçlar
+struct RangeStats {
+    unsigned long partial;           // 206
+    unsigned long long partialBytes;
+    unsigned long unsatisfiable;     // 416
+    unsigned long ifRangeMismatch;   // If-Range tutmadı - tam gövde gönderildi
+};
+
+extern RangeStats rangeStats;
+
+#endif // STATIC_ASSETS_H
@@ -0,0 +1,92 @@
+#ifndef UART_CAPTURE_H
+#define UART_CAPTURE_H
+
+#include <Arduino.h>
+
+// UART trafik kaydı: her TX/RX çerçevesi mikrosaniye zaman damgasıyla sabit boyutlu
+// bir halka tampona (PSRAM varsa PSRAM) yazılır. Tampon dolunca en eski kayıt düşer.
+// İndirilen ikili dosya tools/uart_replay.py ile çözümlenir.
+#define CAPTURE_RING_SIZE_PSRAM (256 * 1024)
+#define CAPTURE_RING_SIZE_HEAP  (16 * 1024)    // PSRAM yoksa
+#define CAPTURE_MAX_PAYLOAD     255
+
+// Dosya biçimi (little-endian):
+//   başlık  : "T43U" | u8 sürüm | u8 ayrılmış | u16 başlık boyu | u32 kayıt sayısı | u32 düşen kayıt
+//   kayıt   : u32 micros() | u16 sıra no | u8 bayraklar | u8 uzunluk | uzunluk bayt veri
+#define CAPTURE_FILE_MAGIC   "T43U"
+#define CAPTURE_FILE_VERSION 1
+
+#define CAPTURE_FLAG_RX        0x01  // 0 = ESP32 -> dsPIC, 1 = dsPIC -> ESP32
+#define CAPTURE_FLAG_TIMEOUT   0x02  // Yanıt gelmedi (uzunluk 0)
+#define CAPTURE_FLAG_TRUNCATED 0x04  // Veri CAPTURE_MAX_PAYLOAD'da kesildi
+
+struct CaptureRecordHeader {
+    uint32_t timestampUs;
+    uint16_t sequence;
+    uint8_t flags;
+    uint8_t length;
+} __attribute__((packed));
+
+struct CaptureFileHeader {
+    char magic[4];
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t headerSize;
+    uint32_t recordCount;
+    uint32_t droppedRecords;
+} __attribute__((packed));
+
+struct UARTCaptureStats {
+    bool inPsram;
+    uint32_t capacity;          // Tampon boyutu (bayt)
+    uint32_t usedBytes;
+    uint32_t records;           // Tamponda duran kayıt
+    uint32_t dropped;           // Yer açmak için silinen eski kayıt
+    uint32_t truncated;
+    uint32_t recordCalls;       // Ölçülen kayıt çağrısı
+    uint64_t totalCycles;       // Kayıt yolunda harcanan CPU çevrimi
+    uint32_t maxCycles;
+};
+
+extern volatile bool uartCaptureEnabled;
+extern UARTCaptureStats uartCaptureStats;
+
+// Canlı aktarım: WebSocket konsolu açıkken çerçeveler ayrıca konsol kuyruğuna kopyalanır
+// (uart_console.cpp)
+extern volatile bool uartMirrorEnabled;
+
+// Sıcak yol: kayıt ve konsol kapalıyken iki karşılaştırma
+void uartCaptureRecord(uint8_t flags, const char* data, size_t length);
+void uartMirrorFrame(uint8_t flags, const char* data, size_t length);
+
+inline void uartCaptureFrame(uint8_t flags, const char* data, size_t length) {
+    if (uartCaptureEnabled) {
+        uartCaptureRecord(flags, data, length);
+    }
+    if (uartMirrorEnabled) {
+        uartMirrorFrame(flags, data, length);
+    }
+}
+
+bool startUARTCapture();
+void stopUARTCapture();
+void clearUARTCapture();
+
+// Okuma sırasında halkaya yazmayı askıya alır; her pause bir resume ile eşlenir.
+// Sayaçlıdır: uartCaptureEnabled'a dokunmaz, iç içe/eşzamanlı indirmeler birbirini bozmaz.
+void uartCapturePause();
+void uartCaptureResume();
+
+// İndirme: başlık + kayıtlar, en eskiden yeniye. Okuma uartCapturePause() altında yapılır.
+size_t uartCaptureExportSize();
+size_t uartCaptureExportRead(size_t offset, uint8_t* buffer, size_t length);
+
+// İndirilecek içeriğin güçlü ETag'i: yeni kayıt, düşen kayıt ve temizleme ile değişir.
+// Kaldığı yerden devam eden indirme (If-Range) değişmiş kaydı tam gövde olarak alır.
+String uartCaptureExportTag();
+
+// Kayıt başına ortalama / en kötü ek yük (ns)
+uint32_t uartCaptureAvgOverheadNs();
+uint32_t uartCaptureMaxOverheadNs();
+
+#endif // UART_CAPTURE_H
@@ -0,0 +1,42 @@
+#ifndef UART_CONSOLE_H
+#define UART_CONSOLE_H
+
+#include <Arduino.h>
+
+// /api/uart/console - WebSocket üzerinden etkileşimli UART konsolu.
+// İstemcinin her metin mesajı bir komuttur ve UART_PRIO_INTERACTIVE ile gönderilir.
+// Konsol açıkken hattaki tüm TX/RX çerçeveleri (başka task'lardan gelenler dahil)
+// mikrosaniye zaman damgasıyla istemciye aktarılır:
+//   {"type":"tx"|"rx","t":<micros>,"data":"...","timeout":false,"truncated":false}
+//   {"type":"result","command":"AN","success":true,"response":"...","ms":12}
+//   {"type":"auth"}  oturum bitti - sunucu bağlantıyı kapatır
+// Tarayıcı WebSocket'i başlık gönderemediği için jeton ?token= ile gelir.
+// Handshake webServerTask'ta yapılır, soket sonra konsol task'ına devredilir;
+// komut beklerken web sunucusu bloklanmaz.
+#define UART_CONSOLE_MAX_MESSAGE     128    // İstemciden kabul edilen en uzun komut
+#define UART_CONSOLE_FRAME_MAX       128    // Aktarılan çerçeve verisi (fazlası kesilir)
+#define UART_CONSOLE_QUEUE_DEPTH     32     // Aktarılmayı bekleyen çerçeve
+#define UART_CONSOLE_COMMAND_TIMEOUT 3000   // ms
+#define UART_CONSOLE_AUTH_INTERVAL   15000  // ms - oturum kontrolü + ping
+#define UART_CONSOLE_TASK_STACK      6144
+
+struct UARTConsoleStats {
+    unsigned long connects;
+    unsigned long rejected;        // Geçersiz jeton / hatalı handshake
+    unsigned long evicted;         // Yeni konsol eskisini kapattı
+    unsigned long commands;
+    unsigned long framesSent;      // İstemciye aktarılan TX/RX çerçevesi
+    unsigned long framesDropped;   // Kuyruk dolu - çerçeve aktarılamadı
+    unsigned long disconnects;
+    bool active;
+};
+
+// Kilit altında kopya (sayaçlar birden çok task'tan yazılır)
+void getUARTConsoleStats(UARTConsoleStats& out);
+
+void initUARTConsole();
+
+// GET /api/uart/console handler'ı (Upgrade: websocket)
+void handleUARTConsole();
+
+#endif // UART_CONSOLE_H
@@ -2,6 +2,7 @@
 #define UART_HANDLER_H
 
 #include <Arduino.h>
+#include "uart_scheduler.h"
 
 // Global değişkenler
 extern bool uartHealthy;
@@ -19,6 +20,37 @@ struct UARTStatistics {
 
 extern UARTStatistics uartStats;
 
+// Sürücü olaylarından hat kalitesi - hat gürültüsünü dsPIC yavaşlığından ayırmak için
+#define UART_LINK_WINDOW_MS 60000        // 1 dakikalık pencereler
+#define UART_LINK_WINDOW_HISTORY 5       // Saklanan tamamlanmış pencere
+#define UART_RESET_MIN_INTERVAL 60000    // İki resetUART() arasında en az süre
+
+struct UARTLinkCounters {
+    uint32_t frameErrors;     // UART_FRAME_ERROR
+    uint32_t parityErrors;    // UART_PARITY_ERROR
+    uint32_t fifoOverflows;   // UART_FIFO_OVF_ERROR - donanım FIFO'su taştı
+    uint32_t bufferFull;      // UART_BUFFER_FULL_ERROR - RX tamponu doldu
+    uint32_t breaks;          // UART_BREAK_ERROR
+    uint32_t timeouts;        // Yanıtı gelmeyen komut
+    uint32_t txBytes;
+    uint32_t rxBytes;
+};
+
+struct UARTLinkWindow {
+    unsigned long startedAt;  // millis()
+    unsigned long durationMs;
+    UARTLinkCounters counters;
+};
+
+struct UARTResetStats {
+    unsigned long resets;
+    unsigned long suppressed;      // Sıklık sınırı ya da teşhis yüzünden yapılmayan reset
+    unsigned long lastResetAt;
+};
+
+extern UARTLinkCounters uartLinkTotals;
+extern UARTResetStats uartResetStats;
+
 // Temel UART fonksiyonları
 void initUART();
 void resetUART();
@@ -26,23 +58,35 @@ bool testUARTConnection();
 void checkUARTHealth();
 String getUARTStatus();
 
+// Hat kalitesi pencereleri: en yeni önce, ilk eleman süren pencere
+int getUARTLinkWindows(UARTLinkWindow* out, int maxCount);
+void rollUARTLinkWindow();
+// "ok", "noise" (çerçeve/parite/break), "overrun" (FIFO/tampon taşması), "dspic-slow" (yalnız zaman aşımı)
+const char* getUARTLinkDiagnosis();
+
 // BaudRate fonksiyonları
 bool changeBaudRate(long newBaudRate);
 bool sendBaudRateCommand(long baudRate);
 
 // Arıza sorgulama fonksiyonları - YENİ
-int getTotalFaultCount();                    // AN komutu ile toplam sayıyı al
-bool requestSpecificFault(int faultNumber);  // Belirli bir arıza adresini sorgula (00001v, 00002v, ...)
+// priority: hattı hangi sınıfla bekleyeceği, cancel: istek kapsamlı iptal jetonu (bkz. uart_scheduler.h)
+int getTotalFaultCount(UARTPriority priority = UART_PRIO_NORMAL,
+                       UARTCancelToken* cancel = NULL);                   // AN komutu ile toplam sayıyı al (-1 = alınamadı)
+bool requestSpecificFault(int faultNumber,
+                          UARTPriority priority = UART_PRIO_NORMAL,
+                          UARTCancelToken* cancel = NULL);                // Belirli bir arıza adresini sorgula (00001v, 00002v, ...)
 bool requestFirstFault();                    // Geriye uyumluluk için (00001v)
 bool requestNextFault();                     // DEPRECATED - kullanmayın
 String getLastFaultResponse();               // Son yanıtı al
 
 // Genel komut gönderme
-bool sendCustomCommand(const String& command, String& response, unsigned long timeout = 0);
+bool sendCustomCommand(const String& command, String& response, unsigned long timeout = 0,
+                       UARTPriority priority = UART_PRIO_NORMAL, UARTCancelToken* cancel = NULL);
 bool sendTestCommand(const String& testCmd);
 
 // Yardımcı fonksiyonlar
 void clearUARTBuffer();
+void sendUARTFrame(const String& frame);
 String safeReadUARTResponse(unsigned long timeout);
 void updateUARTStats(bool success);
 
@@ -0,0 +1,40 @@
+#ifndef UART_PACER_H
+#define UART_PACER_H
+
+#include <Arduino.h>
+
+// Ardışık dsPIC komutları arasındaki boşluk için AIMD hız denetleyicisi.
+// Her başarılı yanıtta boşluk sabit adımla kısalır, hata/zaman aşımında katlanır.
+// Yanıt gecikmesi ortalamanın çok üstüne çıkarsa boşluk kısaltılmaz (dsPIC zorlanıyor).
+#define PACER_INITIAL_GAP_MS   50     // Eski sabit delay(50) ile aynı başlangıç
+#define PACER_MIN_GAP_MS       2
+#define PACER_MAX_GAP_MS       1000
+#define PACER_DECREASE_STEP_MS 2      // Toplamsal azalma
+#define PACER_BACKOFF_FACTOR   2      // Çarpımsal geri çekilme
+#define PACER_SLOW_FACTOR      2      // Gecikme > ortalama x 2 ise yavaş say
+
+struct UARTPacerStats {
+    uint32_t gapMs;             // Şu anki komutlar arası boşluk
+    uint32_t avgLatencyUs;      // Yanıt gecikmesi (üssel ortalama)
+    uint32_t lastLatencyUs;
+    unsigned long successes;
+    unsigned long errors;       // Yanıtsız/boş dönen komutlar
+    unsigned long slowResponses;
+    unsigned long backoffs;     // Çarpımsal geri çekilme sayısı
+    unsigned long waits;        // Boşluk dolmadığı için beklenen komut sayısı
+    uint64_t totalWaitMs;
+};
+
+extern UARTPacerStats uartPacerStats;
+
+// Komuttan önce çağrılır: son yanıttan bu yana boşluk dolmadıysa bekler
+void uartPaceWait();
+
+// Çerçeve gönderildi / yanıt okundu - hattı tutan task çağırır
+void uartPacerFrameSent();
+void uartPacerResponse(bool success);
+
+uint32_t uartPacerGapMs();
+void resetUARTPacer();
+
+#endif // UART_PACER_H
@@ -0,0 +1,66 @@
+#ifndef UART_SCHEDULER_H
+#define UART_SCHEDULER_H
+
+#include <Arduino.h>
+
+// UART iş öncelik sınıfları - küçük değer önce servis edilir
+enum UARTPriority {
+    UART_PRIO_INTERACTIVE = 0,  // Kullanıcı tıklaması: /api/uart/send, tarih-saat ayarı
+    UART_PRIO_NORMAL = 1,       // Sayfa sorguları, NTP gönderimi, toplu arıza aktarımı
+    UART_PRIO_BACKGROUND = 2    // Zaman senkronu, sağlık kontrolü
+};
+
+#define UART_PRIO_COUNT 3
+#define UART_ACQUIRE_TIMEOUT 5000  // ms - hat için en fazla bekleme
+
+// Sınıf başına kuyruk bekleme istatistikleri
+struct UARTQueueStats {
+    unsigned long acquired;     // Hattın kaç kez alındığı
+    unsigned long timeouts;     // Beklerken zaman aşımına düşen işler
+    unsigned long yields;       // Toplu işin üst sınıfa yol verdiği sayı
+    unsigned long waiting;      // Şu an hat bekleyen iş sayısı
+    uint64_t totalWaitUs;       // Toplam bekleme süresi
+    uint32_t maxWaitUs;         // En uzun bekleme
+    uint32_t lastWaitUs;        // Son bekleme
+};
+
+extern UARTQueueStats uartQueueStats[UART_PRIO_COUNT];
+
+// İstek kapsamlı iptal jetonu: HTTP istemcisi koptuğunda ya da süre dolduğunda
+// kuyruktaki iş bırakılır, toplu aktarım kayıtlar arasında durur
+struct UARTCancelToken {
+    bool (*isAlive)(void* context);  // ör. istemci hâlâ bağlı mı (NULL = kontrol yok)
+    void* context;
+    unsigned long deadline;          // millis() cinsinden son an (0 = sınır yok)
+    bool cancelled;                  // bir kez iptal olan jeton iptal kalır
+    bool expired;                    // iptalin sebebi süre (istemci hâlâ bağlı olabilir)
+};
+
+// İptal sayaçları
+struct UARTCancelStats {
+    unsigned long droppedQueued;     // Hat beklerken bırakılan işler
+    unsigned long abortedBulk;       // Kayıtlar arasında durdurulan toplu aktarımlar
+};
+
+extern UARTCancelStats uartCancelStats;
+
+// Hat sahipliği - aynı task içinden iç içe çağrılabilir
+bool uartAcquire(UARTPriority priority, unsigned long maxWaitMs = UART_ACQUIRE_TIMEOUT,
+                 UARTCancelToken* cancel = NULL);
+void uartRelease();
+
+// Toplu işler kayıtlar arasında çağırır: daha öncelikli bekleyen varsa hattı bırakıp geri alır.
+// Jeton iptal olduysa ya da hat geri alınamadıysa false döner; çağıran yine de uartRelease()
+// çağırır (sahip değilse etkisizdir).
+bool uartYield(UARTCancelToken* cancel = NULL);
+bool uartHigherPriorityWaiting();
+
+// Jeton iptal edildi mi (istemci koptu / süre doldu)
+bool uartTokenCancelled(UARTCancelToken* cancel);
+
+// Yardımcı fonksiyonlar
+const char* uartPriorityName(UARTPriority priority);
+UARTPriority uartPriorityFromString(const String& name, UARTPriority fallback);
+String uartLineOwnerName();
+
+#endif // UART_SCHEDULER_H
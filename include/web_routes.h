@@ -7,9 +7,17 @@
 
 void setupWebRoutes();
 void serveStaticFile(const String& path, const String& contentType);
+
+// Range destekli gövde kaynağı: offset'ten en fazla length bayt okur, okunanı döner
+typedef size_t (*ContentReader)(void* context, size_t offset, uint8_t* buffer, size_t length);
+
+// Range / If-Range değerlendirmesi. 206 ya da 416 gönderdiyse true döner; false ise çağıran
+// tam gövdeyi 200 ile gönderir. ETag başlığını çağıran ekler; etag If-Range için kullanılır.
+bool sendRange(const char* contentType, size_t total, const String& etag, const char* contentEncoding,
+               ContentReader reader, void* context);
+size_t readMemoryContent(void* context, size_t offset, uint8_t* buffer, size_t length);
 String getUptime();
 void addSecurityHeaders();
-bool checkRateLimit();
 
 // API Handler fonksiyonları
 void handleStatusAPI();
@@ -38,6 +46,11 @@ void handleClearLogsAPI();
 void handleSystemInfoAPI();
 void handleSessionRefresh();
 void handleUARTTestAPI();
+void handleUARTMetricsAPI();
+void handleUARTCaptureAPI();
+void handleUARTCaptureDownload();
+void handleHttpMetricsAPI();
+void handleRouteMetricsAPI();
 void handleDeviceInfoAPI();
 void handleSystemRebootAPI();
 
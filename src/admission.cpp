@@ -0,0 +1,48 @@
+// admission.cpp - heap'e duyarlı istek kabulü
+#include "admission.h"
+#include "log_system.h"
+
+AdmissionStats admissionStats = {0, 0, 0, 0, 0, UINT32_MAX};
+
+static bool shedding = false;
+
+bool admissionAllow(uint16_t heapKB, bool reserved) {
+    uint32_t largest = ESP.getMaxAllocHeap();
+    uint32_t need = (uint32_t)heapKB * 1024;
+    if (largest < admissionStats.minLargestBlock) {
+        admissionStats.minLargestBlock = largest;
+    }
+
+    if (largest < need + ADMISSION_RESERVE_BYTES) {
+        if (!reserved || largest < need) {
+            admissionStats.rejected++;
+            if (!shedding) {
+                // Dönem başına bir kayıt - her reddi loglamak log tamponunu da zorlar
+                shedding = true;
+                admissionStats.sheddingEpisodes++;
+                addLog("⚠️ Bellek az (en büyük blok " + String(largest) + " B): pahalı istekler reddediliyor",
+                       WARN, "WEB");
+            }
+            return false;
+        }
+        admissionStats.reservedAdmitted++;
+    } else if (shedding && !reserved) {
+        shedding = false;
+        addLog("✅ Bellek toparlandı (en büyük blok " + String(largest) + " B): istekler kabul ediliyor",
+               INFO, "WEB");
+    }
+
+    admissionStats.admitted++;
+    if (largest < ADMISSION_DEGRADE_BYTES) {
+        admissionStats.degraded++;
+    }
+    return true;
+}
+
+bool admissionDegraded() {
+    return ESP.getMaxAllocHeap() < ADMISSION_DEGRADE_BYTES;
+}
+
+bool admissionShedding() {
+    return shedding;
+}
@@ -3,11 +3,12 @@
 #include "log_system.h"
 #include "crypto_utils.h"
 #include "password_policy.h"  // EKLENEN INCLUDE
-#include <WebServer.h>
+#include "http_server.h"
+#include "session_store.h"
 #include <ArduinoJson.h>      // EKLENEN INCLUDE
 
 extern Settings settings;
-extern WebServer server;
+extern AppWebServer server;
 extern PasswordPolicy passwordPolicy;  // EKLENEN EXTERN
 
 static int loginAttempts = 0;
@@ -15,30 +16,28 @@ static unsigned long lockoutTime = 0;
 const int MAX_LOGIN_ATTEMPTS = 5;
 const unsigned long LOCKOUT_DURATION = 300000; // 5 dakika
 
-// Oturumu jeton ile kontrol et
-bool checkSession() {
-    String token = "";
+// İstekteki jeton ("Bearer a1b2c3d4..." formatını bekliyoruz)
+String requestToken() {
     if (server.hasHeader("Authorization")) {
-        // "Bearer a1b2c3d4..." formatını bekliyoruz
         String authHeader = server.header("Authorization");
         if (authHeader.startsWith("Bearer ")) {
-            token = authHeader.substring(7);
+            return authHeader.substring(7);
         }
     }
+    return "";
+}
 
-    if (token.length() == 0 || settings.sessionToken.length() == 0 || token != settings.sessionToken) {
-        return false;
-    }
+// Oturumu jeton ile kontrol et
+bool checkSession() {
+    // /api/batch oturumu bir kez doğruladı; alt istekler tekrar bakmaz
+    if (server.captureAuthenticated()) return true;
 
-    if (millis() - settings.sessionStartTime > settings.SESSION_TIMEOUT) {
-        settings.sessionToken = ""; // Jetonu geçersiz kıl
+    // Aktivite olduğunda oturum süresini yenile
+    SessionResult result = lookupSession(requestToken(), true);
+    if (result == SESSION_EXPIRED) {
         addLog("Oturum zaman aşımına uğradı", INFO, "AUTH");
-        return false;
     }
-    
-    // Aktivite olduğunda oturum süresini yenile
-    settings.sessionStartTime = millis();
-    return true;
+    return result == SESSION_VALID;
 }
 
 void handleUserLogin() {
@@ -70,12 +69,12 @@ void handleUserLogin() {
     if (u == settings.username) {
         String hashedAttempt = sha256(p, settings.passwordSalt);
         if (hashedAttempt == settings.passwordHash) {
-            settings.sessionToken = generateRandomToken(32);
-            settings.sessionStartTime = millis();
+            // Yeni oturum mevcut oturumları düşürmez; tablo doluysa en az kullanılan çıkar
+            String token = createSession();
             loginAttempts = 0;
             lockoutTime = 0;
             
-            addLog("✅ Başarılı giriş: " + u, SUCCESS, "AUTH");
+            addLog("✅ Başarılı giriş: " + u + " (" + String(activeSessionCount()) + " oturum)", SUCCESS, "AUTH");
             
             // Parola değiştirme kontrolü - LOGIN SONRASI
             bool mustChange = mustChangePassword();
@@ -85,7 +84,7 @@ void handleUserLogin() {
             // BASİT JSON response (String concatenation ile)
             String response = "{";
             response += "\"success\":true,";
-            response += "\"token\":\"" + settings.sessionToken + "\",";
+            response += "\"token\":\"" + token + "\",";
             response += "\"mustChangePassword\":" + String(mustChange ? "true" : "false");
             
             if (mustChange) {
@@ -126,22 +125,19 @@ void handleUserLogin() {
 }
 
 void handleUserLogout() {
-    settings.sessionToken = "";
+    revokeSession(requestToken());
     addLog("🚪 Çıkış yapıldı", INFO, "AUTH");
     server.send(200, "application/json", "{\"success\":true}");
 }
 
-// Sadece gelen jetonun geçerli olup olmadığını kontrol eder (WebSocket için)
+// Sadece gelen jetonun geçerli olup olmadığını kontrol eder (SSE / WebSocket için)
 bool isTokenValid(const String& token) {
-    if (token.length() == 0 || settings.sessionToken.length() == 0 || token != settings.sessionToken) {
-        return false;
-    }
-
-    if (millis() - settings.sessionStartTime > settings.SESSION_TIMEOUT) {
-        return false;
-    }
+    // Akış bağlantısı açık diye oturum süresini yenilemeyelim,
+    // bu sadece API isteklerinde ve açık kullanıcı etkinliğinde olmalı.
+    return lookupSession(token, false) == SESSION_VALID;
+}
 
-    // WebSocket aktivitesi için oturum süresini yenilemeyelim,
-    // bu sadece API isteklerinde olmalı.
-    return true;
+// Akış üzerinden gelen kullanıcı etkinliği (panel açık, konsol komutu)
+bool touchSession(const String& token) {
+    return lookupSession(token, true) == SESSION_VALID;
 }
\ No newline at end of file
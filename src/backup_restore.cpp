@@ -7,18 +7,22 @@
 #include "ntp_handler.h"
 #include "crypto_utils.h"
 #include "auth_system.h"  // checkSession için
-#include <WebServer.h>
+#include "state_version.h"
+#include "http_server.h"
+#include "response_cache.h"
+#include "web_routes.h"
 
-extern WebServer server;
+extern AppWebServer server;
 
-// Ayarları JSON formatında export et
+// Ayarları JSON formatında export et. Çıktı yalnızca ayarlar değişince değişir (zaman
+// damgası, boş heap, log sayısı yok; biçim hep aynı): indirme ETag'i bu gövdenin özetidir
+// ve kopan indirme Range/If-Range ile aynı baytlardan devam edebilir.
 String exportSettingsToJSON() {
     // JSON document oluştur (2KB buffer) - Yeni ArduinoJson v7 syntax
     JsonDocument doc;
     
     // Versiyon bilgisi
     doc["version"] = "1.0";
-    doc["timestamp"] = getFormattedTimestamp();
     doc["deviceId"] = ETH.macAddress();
     
     // Network ayarları
@@ -49,11 +53,9 @@ String exportSettingsToJSON() {
     // Log ayarları
     JsonObject logging = doc["logging"].to<JsonObject>();
     logging["maxLogs"] = 50;
-    logging["currentLogs"] = totalLogs;
     
     // Sistem bilgileri
     JsonObject system = doc["system"].to<JsonObject>();
-    system["freeHeap"] = ESP.getFreeHeap();
     system["chipRevision"] = ESP.getChipRevision();
     system["sdkVersion"] = ESP.getSdkVersion();
     system["flashSize"] = ESP.getFlashChipSize();
@@ -61,8 +63,6 @@ String exportSettingsToJSON() {
     // JSON'u string'e serialize et
     String output;
     serializeJsonPretty(doc, output);
-    
-    addLog("✅ Ayarlar JSON formatında export edildi", SUCCESS, "BACKUP");
     return output;
 }
 
@@ -185,6 +185,8 @@ bool importSettingsFromJSON(const String& jsonData) {
         }
         
         prefs.end();
+        bumpStateVersion(STATE_SETTINGS);
+        bumpStateVersion(STATE_NTP);
         
         addLog("✅ Ayarlar başarıyla import edildi", SUCCESS, "RESTORE");
         addLog("⚠️ Yeniden başlatma gerekli", WARN, "RESTORE");
@@ -212,6 +214,7 @@ bool saveBackupToFile(const String& filename) {
     
     file.print(jsonBackup);
     file.close();
+    responseCacheInvalidate(RESPONSE_CACHE_SYSTEM_INFO);   // Dosya sistemi doluluğu değişti
     
     addLog("✅ Backup dosyası kaydedildi: " + filename, SUCCESS, "BACKUP");
     return true;
@@ -251,12 +254,20 @@ void handleBackupDownload() {
     filename.replace(":", "_");
     
     // HTTP response headers - Blob indirme için güncellendi
-    server.setContentLength(jsonBackup.length());
     server.sendHeader("Content-Type", "application/json");
     server.sendHeader("Content-Disposition", "attachment; filename=\"" + filename + "\"");
     server.sendHeader("Access-Control-Expose-Headers", "Content-Disposition");
     
+    // İçerik özeti: ayarlar değişmediyse aynıdır; değiştiyse If-Range tutmaz, tam yedek gider
+    String etag = "\"" + sha256(jsonBackup, "backup").substring(0, 16) + "\"";
+    server.sendHeader("ETag", etag);
+    if (sendRange("application/json", jsonBackup.length(), etag, NULL,
+                  readMemoryContent, (void*)jsonBackup.c_str())) {
+        return;
+    }
+    
     // JSON'u gönder
+    server.setContentLength(jsonBackup.length());
     server.send(200, "application/json", jsonBackup);
     
     addLog("📥 Backup indirildi", INFO, "BACKUP");
@@ -330,6 +341,7 @@ void createAutomaticBackup() {
         // 7'den fazla backup varsa en eskisini sil
         if (backupCount >= 7 && oldestBackup != "") {
             LittleFS.remove("/" + oldestBackup);
+            responseCacheInvalidate(RESPONSE_CACHE_SYSTEM_INFO);
             addLog("🗑️ Eski backup silindi: " + oldestBackup, INFO, "BACKUP");
         }
         
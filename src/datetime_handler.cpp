@@ -2,9 +2,10 @@
 #include "uart_handler.h"
 #include "log_system.h"
 #include <time.h>
+#include <freertos/semphr.h>
 
-// Global datetime verisi
-DateTimeData datetimeData = {
+// Global datetime verisi - yalnızca datetimeMutex altında
+static DateTimeData datetimeData = {
     .rawData = "",
     .date = "",
     .time = "",
@@ -17,12 +18,41 @@ static CommandHistory commandHistory[10];
 static int historyIndex = 0;
 static int historyCount = 0;
 
+static SemaphoreHandle_t datetimeMutex = NULL;
+
+void initDateTimeHandler() {
+    if (datetimeMutex == NULL) {
+        datetimeMutex = xSemaphoreCreateMutex();
+    }
+}
+
+static void lockDateTime() {
+    if (datetimeMutex != NULL) xSemaphoreTake(datetimeMutex, portMAX_DELAY);
+}
+
+static void unlockDateTime() {
+    if (datetimeMutex != NULL) xSemaphoreGive(datetimeMutex);
+}
+
+void getDateTimeSnapshot(DateTimeData& out) {
+    lockDateTime();
+    out = datetimeData;
+    unlockDateTime();
+}
+
+unsigned long getDateTimeLastUpdate() {
+    lockDateTime();
+    unsigned long lastUpdate = datetimeData.isValid ? datetimeData.lastUpdate : 0;
+    unlockDateTime();
+    return lastUpdate;
+}
+
 // dsPIC'ten tarih-saat bilgisi iste ('DN' komutu)
-bool requestDateTimeFromDsPIC() {
+bool requestDateTimeFromDsPIC(UARTPriority priority) {
     String response;
     
     // 'DN' komutunu gönder
-    if (!sendCustomCommand("DN", response, 3000)) {
+    if (!sendCustomCommand("DN", response, 3000, priority)) {
         addLog("❌ dsPIC'ten tarih-saat bilgisi alınamadı", ERROR, "DATETIME");
         addCommandToHistory("DN", false, "Timeout/Error");
         return false;
@@ -32,8 +62,6 @@ bool requestDateTimeFromDsPIC() {
     
     // Yanıtı parse et
     if (parseeDateTimeResponse(response)) {
-        datetimeData.lastUpdate = millis();
-        datetimeData.isValid = true;
         addLog("✅ Tarih-saat bilgisi güncellendi", SUCCESS, "DATETIME");
         addCommandToHistory("DN", true, response);
         return true;
@@ -44,15 +72,17 @@ bool requestDateTimeFromDsPIC() {
     }
 }
 
-// dsPIC'ten gelen yanıtı parse et
+// dsPIC'ten gelen yanıtı parse et; geçerliyse tarih, saat ve güncelleme anı birlikte yazılır
 // Beklenen format: "D:22/02/25 11:22:33"
 bool parseeDateTimeResponse(const String& response) {
     if (response.length() < 10) {
         return false;
     }
     
-    // Raw datayı sakla
-    datetimeData.rawData = response;
+    // Değerler önce yerelde hazırlanır, paylaşılan yapıya kilit altında tek seferde geçer
+    String date;
+    String time;
+    bool parsed = false;
     
     // "D:" prefix'ini kontrol et
     if (response.startsWith("D:")) {
@@ -69,51 +99,65 @@ bool parseeDateTimeResponse(const String& response) {
             if (dateStr.length() == 8 && dateStr.charAt(2) == '/' && dateStr.charAt(5) == '/') {
                 // Saat formatını kontrol et (HH:MM:SS)
                 if (timeStr.length() == 8 && timeStr.charAt(2) == ':' && timeStr.charAt(5) == ':') {
-                    datetimeData.date = formatDateForDisplay(dateStr);
-                    datetimeData.time = formatTimeForDisplay(timeStr);
-                    return true;
+                    date = formatDateForDisplay(dateStr);
+                    time = formatTimeForDisplay(timeStr);
+                    parsed = true;
                 }
             }
         }
     }
     
-    return false;
+    lockDateTime();
+    datetimeData.rawData = response;   // Raw data her durumda saklanır
+    if (parsed) {
+        datetimeData.date = date;
+        datetimeData.time = time;
+        datetimeData.lastUpdate = millis();
+        datetimeData.isValid = true;
+    }
+    unlockDateTime();
+    return parsed;
 }
 
 // dsPIC'e tarih ve saat ayarı gönder
-bool setDateTimeToDsPIC(const String& date, const String& time) {
+bool setDateTimeToDsPIC(const String& date, const String& time, UARTPriority priority) {
     if (!validateDateTime(date, time)) {
         addLog("❌ Geçersiz tarih veya saat formatı", ERROR, "DATETIME");
         return false;
     }
     
+    // Saat, tarih ve doğrulama komutları araya başka iş girmeden gitsin
+    if (!uartAcquire(priority)) {
+        addLog("❌ UART hattı meşgul, tarih-saat ayarlanamadı", ERROR, "DATETIME");
+        return false;
+    }
+    
     // Önce saat komutunu hazırla ve gönder
     String timeCommand = formatTimeCommand(time);
     String timeResponse;
     
     addLog("Saat ayarlama komutu gönderiliyor: " + timeCommand, INFO, "DATETIME");
     
-    if (!sendCustomCommand(timeCommand, timeResponse, 2000)) {
+    if (!sendCustomCommand(timeCommand, timeResponse, 2000, priority)) {
         addLog("❌ Saat ayarlama komutu gönderilirken hata", ERROR, "DATETIME");
         addCommandToHistory(timeCommand, false, "Timeout/Error");
+        uartRelease();
         return false;
     }
     
     addCommandToHistory(timeCommand, true, timeResponse);
     addLog("Saat komutu yanıtı: " + timeResponse, DEBUG, "DATETIME");
     
-    // Kısa bir bekleme
-    delay(500);
-    
     // Sonra tarih komutunu hazırla ve gönder
     String dateCommand = formatDateCommand(date);
     String dateResponse;
     
     addLog("Tarih ayarlama komutu gönderiliyor: " + dateCommand, INFO, "DATETIME");
     
-    if (!sendCustomCommand(dateCommand, dateResponse, 2000)) {
+    if (!sendCustomCommand(dateCommand, dateResponse, 2000, priority)) {
         addLog("❌ Tarih ayarlama komutu gönderilirken hata", ERROR, "DATETIME");
         addCommandToHistory(dateCommand, false, "Timeout/Error");
+        uartRelease();
         return false;
     }
     
@@ -122,10 +166,10 @@ bool setDateTimeToDsPIC(const String& date, const String& time) {
     
     addLog("✅ Tarih-saat ayarlama tamamlandı", SUCCESS, "DATETIME");
     
-    // Ayarlama sonrası kontrol et
-    delay(1000);
-    requestDateTimeFromDsPIC();
+    // Ayarlama sonrası kontrol et (komutlar arası boşluğu uart_pacer belirler)
+    requestDateTimeFromDsPIC(priority);
     
+    uartRelease();
     return true;
 }
 
@@ -203,7 +247,7 @@ String getCurrentESP32DateTime() {
 }
 
 // ESP32 saati ile senkronize et
-bool syncWithESP32Time() {
+bool syncWithESP32Time(UARTPriority priority) {
     struct tm timeinfo;
     if (!getLocalTime(&timeinfo, 10)) {
         addLog("❌ ESP32 sistem saati alınamadı", ERROR, "DATETIME");
@@ -221,35 +265,40 @@ bool syncWithESP32Time() {
     
     addLog("ESP32 saati ile senkronizasyon: " + espDate + " " + espTime, INFO, "DATETIME");
     
-    return setDateTimeToDsPIC(espDate, espTime);
+    return setDateTimeToDsPIC(espDate, espTime, priority);
 }
 
 // Komut geçmişine ekle
 void addCommandToHistory(const String& command, bool success, const String& response) {
-    commandHistory[historyIndex].command = command;
-    commandHistory[historyIndex].success = success;
-    commandHistory[historyIndex].response = response;
-    
-    // Timestamp ekle
+    // Timestamp kilit dışında hazırlanır (getLocalTime bekleyebilir)
+    String timestamp;
     struct tm timeinfo;
     if (getLocalTime(&timeinfo, 10)) {
         char buffer[32];
         strftime(buffer, sizeof(buffer), "%H:%M:%S", &timeinfo);
-        commandHistory[historyIndex].timestamp = String(buffer);
+        timestamp = String(buffer);
     } else {
-        commandHistory[historyIndex].timestamp = String(millis() / 1000) + "s";
+        timestamp = String(millis() / 1000) + "s";
     }
     
+    lockDateTime();
+    commandHistory[historyIndex].command = command;
+    commandHistory[historyIndex].success = success;
+    commandHistory[historyIndex].response = response;
+    commandHistory[historyIndex].timestamp = timestamp;
+    
     historyIndex = (historyIndex + 1) % 10;
     if (historyCount < 10) {
         historyCount++;
     }
+    unlockDateTime();
 }
 
 // Komut geçmişini JSON olarak döndür
 String getCommandHistoryJSON() {
     String json = "[";
     
+    lockDateTime();
     for (int i = 0; i < historyCount; i++) {
         int idx = (historyIndex - 1 - i + 10) % 10;
         
@@ -262,6 +311,7 @@ String getCommandHistoryJSON() {
         json += "\"response\":\"" + commandHistory[idx].response + "\"";
         json += "}";
     }
+    unlockDateTime();
     
     json += "]";
     return json;
@@ -293,18 +343,23 @@ String formatTimeForDisplay(const String& rawTime) {
 
 // DateTime verisi geçerli mi?
 bool isDateTimeDataValid() {
-    return datetimeData.isValid && 
-           datetimeData.date.length() > 0 && 
-           datetimeData.time.length() > 0;
+    lockDateTime();
+    bool valid = datetimeData.isValid && 
+                 datetimeData.date.length() > 0 && 
+                 datetimeData.time.length() > 0;
+    unlockDateTime();
+    return valid;
 }
 
 // DateTime verilerini temizle
 void clearDateTimeData() {
+    lockDateTime();
     datetimeData.rawData = "";
     datetimeData.date = "";
     datetimeData.time = "";
     datetimeData.lastUpdate = 0;
     datetimeData.isValid = false;
+    unlockDateTime();
     
     addLog("DateTime verileri temizlendi", INFO, "DATETIME");
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+// dspic_cache.cpp - dsPIC değerleri için bayat-iken-yenile önbelleği
+#include "dspic_cache.h"
+#include "uart_handler.h"
+#include "datetime_handler.h"
+#include "log_system.h"
+#include <freertos/semphr.h>
+
+DsPICCacheStats dspicCacheStats[DSPIC_CACHE_ITEMS] = {};
+
+struct CacheEntry {
+    unsigned long ttlMs;
+    unsigned long fetchedAt;        // millis() - değerin alındığı an
+    bool hasValue;
+    volatile bool refreshPending;   // web task ister, uartTask yapar
+};
+
+static CacheEntry entries[DSPIC_CACHE_ITEMS] = {
+    {FAULT_COUNT_CACHE_TTL, 0, false, false},
+    {DATETIME_CACHE_TTL, 0, false, false},
+    {LINK_HEALTH_CACHE_TTL, 0, false, false}
+};
+
+// Önbellekteki değerler - web ve UART task'ları arasında paylaşılır
+static SemaphoreHandle_t cacheMutex = NULL;
+static int cachedFaultCount = 0;
+static bool cachedLinkSuccess = false;
+static String cachedLinkResponse = "";
+
+void initDsPICCache() {
+    if (cacheMutex == NULL) {
+        cacheMutex = xSemaphoreCreateMutex();
+    }
+}
+
+static void lockCache() {
+    if (cacheMutex != NULL) xSemaphoreTake(cacheMutex, portMAX_DELAY);
+}
+
+static void unlockCache() {
+    if (cacheMutex != NULL) xSemaphoreGive(cacheMutex);
+}
+
+// Tarih-saat değeri datetimeData'da tutulur; yaşı da oradan hesaplanır
+static void syncDateTimeEntry() {
+    CacheEntry& entry = entries[DSPIC_CACHE_DATETIME];
+    unsigned long lastUpdate = getDateTimeLastUpdate();
+    entry.hasValue = lastUpdate > 0;
+    entry.fetchedAt = lastUpdate;
+}
+
+bool dspicCacheHasValue(DsPICCacheItem item) {
+    if (item == DSPIC_CACHE_DATETIME) syncDateTimeEntry();
+    return entries[item].hasValue;
+}
+
+unsigned long dspicCacheAge(DsPICCacheItem item) {
+    if (item == DSPIC_CACHE_DATETIME) syncDateTimeEntry();
+    if (!entries[item].hasValue) return 0;
+    return millis() - entries[item].fetchedAt;
+}
+
+bool dspicCacheIsStale(DsPICCacheItem item) {
+    if (item == DSPIC_CACHE_DATETIME) syncDateTimeEntry();
+    return !entries[item].hasValue || dspicCacheAge(item) >= entries[item].ttlMs;
+}
+
+// Değeri bayat işaretler: bir sonraki okuma eski değeri döndürür ve yenileme ister.
+// Tarih-saat için clearDateTimeData() kullanılır (yaş datetimeData'dan gelir).
+void dspicCacheInvalidate(DsPICCacheItem item) {
+    if (item == DSPIC_CACHE_DATETIME) return;
+    entries[item].fetchedAt = millis() - entries[item].ttlMs;
+}
+
+// Değer varsa taze/bayat ayrımını yapar; true = önbellekten servis edilebilir
+static bool serveFromCache(DsPICCacheItem item, bool forceRefresh) {
+    if (item == DSPIC_CACHE_DATETIME) syncDateTimeEntry();
+
+    CacheEntry& entry = entries[item];
+    if (forceRefresh || !entry.hasValue) {
+        dspicCacheStats[item].misses++;
+        return false;
+    }
+
+    if (dspicCacheAge(item) < entry.ttlMs) {
+        dspicCacheStats[item].hits++;
+    } else {
+        dspicCacheStats[item].staleHits++;
+        entry.refreshPending = true;
+    }
+    return true;
+}
+
+// UART'tan okuyup önbelleğe yazar; hat sahipliği çağırana aittir
+static bool fetchFaultCount(UARTPriority priority, UARTCancelToken* cancel) {
+    int count = getTotalFaultCount(priority, cancel);
+
+    // Hata -1'dir; 0 geçerli bir sonuçtur (boş arıza kaydı) ve o da önbelleğe alınır
+    if (count < 0) return false;
+
+    lockCache();
+    cachedFaultCount = count;
+    entries[DSPIC_CACHE_FAULT_COUNT].fetchedAt = millis();
+    entries[DSPIC_CACHE_FAULT_COUNT].hasValue = true;
+    unlockCache();
+    return true;
+}
+
+static bool fetchLinkHealth(UARTPriority priority, UARTCancelToken* cancel) {
+    String response;
+    bool success = sendCustomCommand("TEST", response, 2000, priority, cancel);
+
+    // İptal edilen test bir sonuç değildir
+    if (uartTokenCancelled(cancel)) return false;
+
+    lockCache();
+    cachedLinkSuccess = success;
+    cachedLinkResponse = response;
+    entries[DSPIC_CACHE_LINK_HEALTH].fetchedAt = millis();
+    entries[DSPIC_CACHE_LINK_HEALTH].hasValue = true;
+    unlockCache();
+    return true;
+}
+
+bool getCachedFaultCount(int& count, UARTPriority priority, UARTCancelToken* cancel, bool forceRefresh) {
+    if (!serveFromCache(DSPIC_CACHE_FAULT_COUNT, forceRefresh) &&
+        !fetchFaultCount(priority, cancel)) {
+        count = 0;
+        return false;
+    }
+
+    lockCache();
+    count = cachedFaultCount;
+    unlockCache();
+    return true;
+}
+
+bool getCachedDateTime(UARTPriority priority, UARTCancelToken* cancel, bool forceRefresh) {
+    if (serveFromCache(DSPIC_CACHE_DATETIME, forceRefresh)) {
+        return true;
+    }
+    if (uartTokenCancelled(cancel)) {
+        return false;
+    }
+    return requestDateTimeFromDsPIC(priority);
+}
+
+bool getCachedLinkHealth(bool& success, String& response, UARTPriority priority,
+                         UARTCancelToken* cancel, bool forceRefresh) {
+    if (!serveFromCache(DSPIC_CACHE_LINK_HEALTH, forceRefresh) &&
+        !fetchLinkHealth(priority, cancel)) {
+        return false;
+    }
+
+    lockCache();
+    success = cachedLinkSuccess;
+    response = cachedLinkResponse;
+    unlockCache();
+    return true;
+}
+
+// Her çağrıda en fazla bir öğe yenilenir; uartTask'ın döngüsü uzamaz.
+// Hat meşgulse bu tur atlanır, istek bekler.
+void processDsPICCacheRefresh() {
+    for (int i = 0; i < DSPIC_CACHE_ITEMS; i++) {
+        DsPICCacheItem item = (DsPICCacheItem)i;
+        if (!entries[item].refreshPending) continue;
+
+        if (!uartAcquire(UART_PRIO_BACKGROUND, 100)) {
+            return;
+        }
+
+        bool ok = false;
+        switch (item) {
+            case DSPIC_CACHE_FAULT_COUNT:
+                ok = fetchFaultCount(UART_PRIO_BACKGROUND, NULL);
+                break;
+            case DSPIC_CACHE_DATETIME:
+                ok = requestDateTimeFromDsPIC(UART_PRIO_BACKGROUND);
+                break;
+            case DSPIC_CACHE_LINK_HEALTH:
+                ok = fetchLinkHealth(UART_PRIO_BACKGROUND, NULL);
+                break;
+        }
+        uartRelease();
+
+        entries[item].refreshPending = false;
+        if (ok) {
+            dspicCacheStats[item].refreshes++;
+        } else {
+            dspicCacheStats[item].refreshFailures++;
+            addLog(String("⚠️ Önbellek yenilenemedi: ") + dspicCacheItemName(item), WARN, "CACHE");
+        }
+        return;
+    }
+}
+
+const char* dspicCacheItemName(DsPICCacheItem item) {
+    switch (item) {
+        case DSPIC_CACHE_FAULT_COUNT: return "faultCount";
+        case DSPIC_CACHE_DATETIME:    return "datetime";
+        case DSPIC_CACHE_LINK_HEALTH: return "linkHealth";
+        default:                      return "unknown";
+    }
+}
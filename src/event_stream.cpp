@@ -0,0 +1,290 @@
+// event_stream.cpp - /api/events (Server-Sent Events)
+#include "event_stream.h"
+#include "http_server.h"
+#include "auth_system.h"
+#include "settings.h"
+#include "log_system.h"
+#include "time_sync.h"
+#include "uart_handler.h"
+#include "response_cache.h"
+#include <ETH.h>
+
+extern AppWebServer server;
+extern Settings settings;
+extern String getUptime();
+
+EventStreamStats eventStreamStats = {0, 0, 0, 0, 0, 0, 0};
+
+struct SSEClient {
+    WiFiClient client;
+    String token;
+    unsigned long connectedAt;
+    bool active;
+};
+
+static SSEClient clients[SSE_MAX_CLIENTS];
+static int clientCount = 0;
+
+static unsigned long logCursor = 0;
+static int lastAlertCount = -1;
+static unsigned long lastStatusCheck = 0;
+static unsigned long lastSystemCheck = 0;
+static unsigned long lastHeartbeat = 0;
+
+// Son gönderilen değerler (JSON metni) - yalnız değişen alanlar yayınlanır
+#define STATUS_FIELD_COUNT 9
+#define SYSTEM_FIELD_COUNT 9
+static const char* const statusKeys[STATUS_FIELD_COUNT] = {
+    "datetime", "uptime", "deviceName", "tmName", "deviceIP",
+    "ethernetStatus", "timeSynced", "freeHeap", "totalHeap"
+};
+static const char* const systemKeys[SYSTEM_FIELD_COUNT] = {
+    "uptime", "freeHeap", "usedHeap", "minFreeHeap", "txCount",
+    "rxCount", "errors", "successRate", "fsUsed"
+};
+static String lastStatus[STATUS_FIELD_COUNT];
+static String lastSystem[SYSTEM_FIELD_COUNT];
+
+static String jsonQuote(const String& value) {
+    String out = "\"";
+    for (unsigned int i = 0; i < value.length(); i++) {
+        char c = value[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '\r') {
+            out += "\\r";
+        } else if ((uint8_t)c < 0x20) {
+            char esc[7];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            out += esc;
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+static void readStatusFields(String values[STATUS_FIELD_COUNT]) {
+    values[0] = jsonQuote(getCurrentDateTime());
+    values[1] = jsonQuote(getUptime());
+    values[2] = jsonQuote(settings.deviceName);
+    values[3] = jsonQuote(settings.transformerStation);
+    values[4] = jsonQuote(ETH.localIP().toString());
+    values[5] = ETH.linkUp() ? "true" : "false";
+    values[6] = isTimeSynced() ? "true" : "false";
+    values[7] = String(ESP.getFreeHeap());
+    values[8] = String(ESP.getHeapSize());
+}
+
+static void readSystemFields(String values[SYSTEM_FIELD_COUNT]) {
+    values[0] = String(millis() / 1000);
+    values[1] = String(ESP.getFreeHeap());
+    values[2] = String(ESP.getHeapSize() - ESP.getFreeHeap());
+    values[3] = String(ESP.getMinFreeHeap());
+    values[4] = String(uartStats.totalFramesSent);
+    values[5] = String(uartStats.totalFramesReceived);
+    values[6] = String(uartStats.frameErrors + uartStats.checksumErrors + uartStats.timeoutErrors);
+    values[7] = String(uartStats.successRate, 1);
+    // Tick başına blok taraması yapılmaz - /api/system-info ile aynı saklı değer
+    size_t fsTotal = 0;
+    size_t fsUsed = 0;
+    cachedFilesystemUsage(fsTotal, fsUsed);
+    values[8] = String(fsUsed);
+}
+
+// Değişen alanlardan {"a":1,...} üretir ve son değerleri günceller; değişiklik yoksa "".
+// full: yeni istemciye tüm alanlar - son değerlere dokunulmaz, diğer istemciler delta kaçırmaz
+static String diffFields(const char* const keys[], String last[], String current[], int count, bool full) {
+    String out;
+    for (int i = 0; i < count; i++) {
+        if (!full && current[i] == last[i]) continue;
+        out += out.length() == 0 ? "{" : ",";
+        out += "\"" + String(keys[i]) + "\":" + current[i];
+        if (!full) last[i] = current[i];
+    }
+    return out.length() > 0 ? out + "}" : out;
+}
+
+static String formatEvent(const char* type, const String& data, unsigned long id = 0) {
+    String event = "event: " + String(type) + "\n";
+    if (id > 0) event += "id: " + String(id) + "\n";
+    return event + "data: " + data + "\n\n";
+}
+
+static String formatLogEvent(unsigned long seq, const LogEntry& entry) {
+    String data = "{\"t\":" + jsonQuote(entry.timestamp) + ",\"m\":" + jsonQuote(entry.message) +
+                  ",\"l\":\"" + logLevelToString(entry.level) + "\",\"s\":" + jsonQuote(entry.source) + "}";
+    return formatEvent("log", data, seq);
+}
+
+static int countRecentAlerts() {
+    int count = 0;
+    lockLogs();
+    for (int i = 0; i < totalLogs && count < 10; i++) {
+        int idx = (logIndex - 1 - i + 50) % 50;
+        if (logs[idx].level == ERROR || logs[idx].level == WARN) count++;
+    }
+    unlockLogs();
+    return count;
+}
+
+static void dropClient(SSEClient& c, unsigned long& reason) {
+    c.client.stop();
+    c.client = WiFiClient();
+    c.token = "";
+    c.active = false;
+    clientCount--;
+    reason++;
+}
+
+static bool writeClient(SSEClient& c, const String& text) {
+    if (!c.client.connected() ||
+        c.client.write((const uint8_t*)text.c_str(), text.length()) != text.length()) {
+        dropClient(c, eventStreamStats.dropped);
+        return false;
+    }
+    return true;
+}
+
+static void broadcast(const String& text) {
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (clients[i].active && writeClient(clients[i], text)) {
+            eventStreamStats.events++;
+        }
+    }
+}
+
+void handleEventStream() {
+    String token = server.arg("token");
+    if (!isTokenValid(token)) {
+        eventStreamStats.rejected++;
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+
+    // Havuz doluysa en eski bağlantıyı kapat (sekme yenilemeleri eski soketi bırakır)
+    SSEClient* slot = NULL;
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (!clients[i].active) {
+            slot = &clients[i];
+            break;
+        }
+        if (slot == NULL || clients[i].connectedAt < slot->connectedAt) {
+            slot = &clients[i];
+        }
+    }
+    if (slot->active) {
+        dropClient(*slot, eventStreamStats.evicted);
+    }
+
+    // İlk istemci: sayaçları şimdiki duruma getir
+    if (clientCount == 0) {
+        logCursor = logSequence;
+        lastAlertCount = countRecentAlerts();
+    }
+
+    String head = "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\n"
+                  "Cache-Control: no-cache\r\nConnection: keep-alive\r\n";
+    for (int i = 0; i < SECURITY_HEADER_COUNT; i++) {
+        head += String(securityHeaders[i][0]) + ": " + securityHeaders[i][1] + "\r\n";
+    }
+    head += "\r\nretry: " + String(SSE_RETRY_MS) + "\n\n";
+
+    // Yeni istemciye tam anlık görüntü, sonra yalnız değişiklikler
+    String status[STATUS_FIELD_COUNT];
+    String system[SYSTEM_FIELD_COUNT];
+    readStatusFields(status);
+    readSystemFields(system);
+    head += formatEvent("status", diffFields(statusKeys, lastStatus, status, STATUS_FIELD_COUNT, true));
+    head += formatEvent("system", diffFields(systemKeys, lastSystem, system, SYSTEM_FIELD_COUNT, true));
+    head += formatEvent("notifications", "{\"count\":" + String(lastAlertCount) + "}");
+
+    slot->client = server.detachClient();
+    slot->client.setNoDelay(true);
+    slot->token = token;
+    slot->connectedAt = millis();
+    slot->active = true;
+    clientCount++;
+    eventStreamStats.connects++;
+
+    if (!writeClient(*slot, head)) return;
+
+    // Yeniden bağlanma: kaçırılan loglar (halkada duruyorsa). Başlangıç
+    // halkadaki en eski kayda kırpılır; eski/uydurma bir kimlik en fazla
+    // halka boyu kadar tur attırır.
+    unsigned long lastId = strtoul(server.header("Last-Event-ID").c_str(), NULL, 10);
+    if (lastId > 0 && lastId < logCursor) {
+        unsigned long start = lastId + 1;
+        unsigned long ringSize = (unsigned long)totalLogs;
+        if (logCursor > ringSize && start < logCursor - ringSize + 1) start = logCursor - ringSize + 1;
+        LogEntry entry;
+        for (unsigned long seq = start; seq <= logCursor; seq++) {
+            if (!getLogBySequence(seq, entry)) continue;
+            if (!writeClient(*slot, formatLogEvent(seq, entry))) return;
+            eventStreamStats.replayedLogs++;
+        }
+    }
+}
+
+void processEventStream() {
+    if (clientCount == 0) return;
+    unsigned long now = millis();
+
+    // Yeni loglar ve bildirim sayısı
+    if (logSequence != logCursor) {
+        LogEntry entry;
+        int sent = 0;
+        while (logCursor < logSequence && sent < SSE_MAX_LOGS_PER_TICK) {
+            logCursor++;
+            if (getLogBySequence(logCursor, entry)) {
+                broadcast(formatLogEvent(logCursor, entry));
+                sent++;
+            }
+        }
+        int alerts = countRecentAlerts();
+        if (alerts != lastAlertCount) {
+            lastAlertCount = alerts;
+            broadcast(formatEvent("notifications", "{\"count\":" + String(alerts) + "}"));
+        }
+    }
+
+    if (now - lastStatusCheck >= SSE_STATUS_INTERVAL) {
+        lastStatusCheck = now;
+        String status[STATUS_FIELD_COUNT];
+        readStatusFields(status);
+        String delta = diffFields(statusKeys, lastStatus, status, STATUS_FIELD_COUNT, false);
+        if (delta.length() > 0) broadcast(formatEvent("status", delta));
+    }
+
+    if (now - lastSystemCheck >= SSE_SYSTEM_INTERVAL) {
+        lastSystemCheck = now;
+        String system[SYSTEM_FIELD_COUNT];
+        readSystemFields(system);
+        String delta = diffFields(systemKeys, lastSystem, system, SYSTEM_FIELD_COUNT, false);
+        if (delta.length() > 0) broadcast(formatEvent("system", delta));
+    }
+
+    // Kalp atışı: ara sunucuların bağlantıyı düşürmemesi ve ölü soketin fark edilmesi için.
+    // Açık akış, polling gibi oturum süresini uzatır; jeton geçersizse istemci çıkışa yönlenir.
+    if (now - lastHeartbeat >= SSE_HEARTBEAT_INTERVAL) {
+        lastHeartbeat = now;
+        for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+            SSEClient& c = clients[i];
+            if (!c.active) continue;
+            if (!isTokenValid(c.token)) {
+                writeClient(c, formatEvent("auth", "{\"reason\":\"expired\"}"));
+                if (c.active) dropClient(c, eventStreamStats.dropped);
+                continue;
+            }
+            touchSession(c.token);
+            if (writeClient(c, ": ping\n\n")) eventStreamStats.heartbeats++;
+        }
+    }
+}
+
+int eventStreamClientCount() {
+    return clientCount;
+}
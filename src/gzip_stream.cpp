@@ -0,0 +1,243 @@
+// gzip_stream.cpp - küçük pencereli akışlı gzip kodlayıcısı
+#include "gzip_stream.h"
+
+#define GZIP_MIN_MATCH 3
+#define GZIP_MAX_MATCH 258
+
+GzipStats gzipStats = {0, 0, 0, 0, 0, 0};
+
+// CRC32 (gzip trailer) - 4 bitlik tablo: 64 bayt, bayt başına iki adım
+static const uint32_t crcNibbleTable[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crcNibbleTable[crc & 0x0F];
+        crc = (crc >> 4) ^ crcNibbleTable[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// RFC 1951 3.2.5 - uzunluk (257..285) ve mesafe (0..29) kodlarının taban değerleri
+static const uint16_t lengthBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t lengthExtra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t distanceBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t distanceExtra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static inline uint16_t hash3(const uint8_t* p) {
+    uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    return (uint16_t)((v * 2654435761u) >> (32 - GZIP_HASH_BITS));
+}
+
+GzipEncoder::GzipEncoder(GzipSink sink, void* context)
+    : _sink(sink), _context(context), _started(false), _crc(0),
+      _inBytes(0), _outBytes(0), _cycles(0), _length(0), _pos(0),
+      _bitBuffer(0), _bitCount(0), _outputUsed(0) {
+    memset(_head, 0, sizeof(_head));
+}
+
+void GzipEncoder::write(const uint8_t* data, size_t length) {
+    uint32_t startCycles = ESP.getCycleCount();
+
+    if (!_started) {
+        // ID1 ID2 CM=8 (deflate) FLG=0 MTIME=0 XFL=0 OS=255 (bilinmiyor)
+        static const uint8_t header[10] = {0x1F, 0x8B, 0x08, 0x00, 0, 0, 0, 0, 0x00, 0xFF};
+        for (size_t i = 0; i < sizeof(header); i++) {
+            putByte(header[i]);
+        }
+        // Tek sabit Huffman bloğu; son blok finish()'te boş olarak kapatılır
+        putBits(0x02, 3);   // BFINAL=0, BTYPE=01
+        _started = true;
+    }
+
+    _crc = crc32Update(_crc, data, length);
+    _inBytes += length;
+
+    while (length > 0) {
+        size_t n = GZIP_BUFFER_SIZE - _length;
+        if (n > length) n = length;
+        memcpy(_window + _length, data, n);
+        _length += n;
+        data += n;
+        length -= n;
+
+        if (_length == GZIP_BUFFER_SIZE) {
+            // Eşleşmeler sonraki girdiye taşabilsin diye son GZIP_MAX_MATCH bayt bekletilir
+            compress(false);
+            slide();
+        }
+    }
+
+    _cycles += ESP.getCycleCount() - startCycles;
+}
+
+void GzipEncoder::finish() {
+    if (!_started) {
+        write((const uint8_t*)"", 0);
+    }
+    uint32_t startCycles = ESP.getCycleCount();
+
+    compress(true);
+    putCode(0, 7);      // Blok sonu (256)
+    putBits(0x03, 3);   // BFINAL=1, BTYPE=01
+    putCode(0, 7);      // Boş son blok
+    if (_bitCount > 0) {
+        putByte(_bitBuffer & 0xFF);
+        _bitBuffer = 0;
+        _bitCount = 0;
+    }
+
+    for (int i = 0; i < 4; i++) putByte((_crc >> (8 * i)) & 0xFF);
+    for (int i = 0; i < 4; i++) putByte((_inBytes >> (8 * i)) & 0xFF);
+    flushOutput();
+
+    _cycles += ESP.getCycleCount() - startCycles;
+}
+
+// Tek girişli özet tablosuyla açgözlü LZ77: her konumda yalnızca aynı öneki son taşıyan
+// konum denenir (zincir yok) - sabit süre, sabit bellek
+void GzipEncoder::compress(bool final) {
+    size_t limit = final ? _length : _length - GZIP_MAX_MATCH;
+
+    while (_pos < limit) {
+        size_t best = 0;
+        size_t distance = 0;
+
+        if (_pos + GZIP_MIN_MATCH <= _length) {
+            uint16_t h = hash3(_window + _pos);
+            size_t candidate = _head[h];
+            _head[h] = _pos + 1;
+
+            if (candidate != 0) {
+                candidate--;
+                size_t maxLength = _length - _pos;
+                if (maxLength > GZIP_MAX_MATCH) maxLength = GZIP_MAX_MATCH;
+                size_t n = 0;
+                while (n < maxLength && _window[candidate + n] == _window[_pos + n]) n++;
+                if (n >= GZIP_MIN_MATCH) {
+                    best = n;
+                    distance = _pos - candidate;
+                }
+            }
+        }
+
+        if (best == 0) {
+            putLiteral(_window[_pos]);
+            _pos++;
+            continue;
+        }
+
+        putMatch(best, distance);
+        // Eşleşmenin içindeki konumlar da özetlenir - sonraki tekrarlar onları bulabilsin
+        for (size_t i = 1; i < best && _pos + i + GZIP_MIN_MATCH <= _length; i++) {
+            _head[hash3(_window + _pos + i)] = _pos + i + 1;
+        }
+        _pos += best;
+    }
+}
+
+// Kodlanmış kısmın son GZIP_HISTORY_SIZE baytı geçmiş olarak tutulur, öncesi atılır
+void GzipEncoder::slide() {
+    if (_pos <= GZIP_HISTORY_SIZE) return;
+
+    size_t shift = _pos - GZIP_HISTORY_SIZE;
+    memmove(_window, _window + shift, _length - shift);
+    _length -= shift;
+    _pos -= shift;
+
+    for (size_t i = 0; i < (1 << GZIP_HASH_BITS); i++) {
+        _head[i] = _head[i] > shift ? _head[i] - shift : 0;
+    }
+}
+
+// Deflate bit sırası: ekstra bitler düşük bitten başlar
+void GzipEncoder::putBits(uint32_t value, uint8_t count) {
+    _bitBuffer |= value << _bitCount;
+    _bitCount += count;
+    while (_bitCount >= 8) {
+        putByte(_bitBuffer & 0xFF);
+        _bitBuffer >>= 8;
+        _bitCount -= 8;
+    }
+}
+
+// Huffman kodları ise yüksek bitten başlar - ters çevrilip yazılır
+void GzipEncoder::putCode(uint16_t code, uint8_t length) {
+    uint16_t reversed = 0;
+    for (uint8_t i = 0; i < length; i++) {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    putBits(reversed, length);
+}
+
+// Sabit Huffman tablosu (RFC 1951 3.2.6)
+void GzipEncoder::putLiteral(uint8_t value) {
+    if (value < 144) {
+        putCode(0x30 + value, 8);
+    } else {
+        putCode(0x190 + (value - 144), 9);
+    }
+}
+
+void GzipEncoder::putMatch(uint16_t length, uint16_t distance) {
+    int l = 28;
+    while (lengthBase[l] > length) l--;
+    uint16_t symbol = 257 + l;
+    if (symbol < 280) {
+        putCode(symbol - 256, 7);
+    } else {
+        putCode(0xC0 + (symbol - 280), 8);
+    }
+    putBits(length - lengthBase[l], lengthExtra[l]);
+
+    int d = 29;
+    while (distanceBase[d] > distance) d--;
+    putCode(d, 5);
+    putBits(distance - distanceBase[d], distanceExtra[d]);
+}
+
+void GzipEncoder::putByte(uint8_t value) {
+    _output[_outputUsed++] = value;
+    if (_outputUsed == GZIP_OUTPUT_SIZE) {
+        flushOutput();
+    }
+}
+
+void GzipEncoder::flushOutput() {
+    if (_outputUsed == 0) return;
+    _sink(_context, _output, _outputUsed);
+    _outBytes += _outputUsed;
+    _outputUsed = 0;
+}
+
+bool acceptsGzipEncoding(const String& acceptEncoding) {
+    String value = acceptEncoding;
+    value.toLowerCase();
+    int at = value.indexOf("gzip");
+    if (at < 0) return false;
+
+    int end = value.indexOf(',', at);
+    String params = value.substring(at + 4, end < 0 ? value.length() : end);
+    params.replace(" ", "");
+    if (params.startsWith(";q=")) {
+        return params.substring(3).toFloat() > 0;
+    }
+    return true;
+}
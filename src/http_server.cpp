@@ -0,0 +1,1062 @@
+// http_server.cpp - WebServer üzerine ertelenmiş (UART'ı bekleyen) yanıtlar
+#include "http_server.h"
+#include "log_system.h"
+#include "rate_limiter.h"
+#include "gzip_stream.h"
+#include "admission.h"
+#include "settings.h"
+#include <freertos/queue.h>
+#include <lwip/sockets.h>
+#include <new>
+
+const char* const securityHeaders[SECURITY_HEADER_COUNT][2] = {
+    {"X-Content-Type-Options", "nosniff"},
+    {"X-Frame-Options", "DENY"},
+    {"X-XSS-Protection", "1; mode=block"},
+    {"Referrer-Policy", "strict-origin-when-cross-origin"},
+    {"Content-Security-Policy", "default-src 'self' 'unsafe-inline'"}
+};
+
+static DeferredStats deferredStats = {0, 0, 0, 0, 0, 0};
+static portMUX_TYPE deferredStatsMux = portMUX_INITIALIZER_UNLOCKED;
+
+void getDeferredStats(DeferredStats& out) {
+    portENTER_CRITICAL(&deferredStatsMux);
+    out = deferredStats;
+    portEXIT_CRITICAL(&deferredStatsMux);
+}
+KeepAliveStats keepAliveStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+JsonStreamStats jsonStreamStats = {0, 0, 0, 0};
+RouteStats routeStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+// İstekten okunacak başlıklar (Authorization collectHeaders tarafından her zaman eklenir)
+static const char* collectedHeaderKeys[] = {"Connection", "If-None-Match", "Last-Event-ID", "Accept-Encoding",
+                                            "Range", "If-Range",
+                                            "Upgrade", "Sec-WebSocket-Key", "Sec-WebSocket-Version"};
+
+static QueueHandle_t deferredQueue = NULL;
+static TaskHandle_t deferredTaskHandle = NULL;
+
+String DeferredRequest::arg(const char* name) const {
+    for (int i = 0; i < argCount; i++) {
+        if (argNames[i] == name) return argValues[i];
+    }
+    return "";
+}
+
+bool DeferredRequest::hasArg(const char* name) const {
+    for (int i = 0; i < argCount; i++) {
+        if (argNames[i] == name) return true;
+    }
+    return false;
+}
+
+static bool isDeferredClientAlive(void* context) {
+    return static_cast<WiFiClient*>(context)->connected();
+}
+
+// 429 yazıldıktan sonra: FIN gönderilir, istemcinin kalan verisi sınırlı biçimde okunur
+static void drainRejectedClient(WiFiClient& client) {
+    shutdown(client.fd(), SHUT_WR);
+    uint8_t buffer[128];
+    size_t drained = 0;
+    unsigned long start = millis();
+    while (drained < REJECT_DRAIN_BYTES && millis() - start < REJECT_DRAIN_TIMEOUT && client.connected()) {
+        int available = client.available();
+        if (available <= 0) {
+            delay(1);
+            continue;
+        }
+        int got = client.read(buffer, available < (int)sizeof(buffer) ? available : sizeof(buffer));
+        if (got <= 0) break;
+        drained += got;
+    }
+}
+
+AppWebServer::AppWebServer(int port)
+    : WebServer(port),
+      _idleTimeoutMs(KEEPALIVE_IDLE_TIMEOUT),
+      _maxRequests(KEEPALIVE_MAX_REQUESTS),
+      _detachCurrent(false),
+      _headerPending(false),
+      _keepAliveAllowed(false),
+      _responseKeepAlive(false),
+      _remainingRequests(0),
+      _rateChecked(false),
+      _rateLimited(false),
+      _retryAfter(1),
+      _routes(NULL),
+      _routeCount(0),
+      _prefixes(NULL),
+      _prefixCount(0),
+      _responseStatus(0),
+      _responseBytes(0),
+      _responseWrites(0),
+      _countBody(true),
+      _metricsDeferred(false),
+      _metricsSlot(0),
+      _requestStartUs(0),
+      _capture(NULL),
+      _captureAuthenticated(false) {
+    for (int i = 0; i < KEEPALIVE_MAX_CONNECTIONS; i++) {
+        _slots[i].active = false;
+        _slots[i].requests = 0;
+        _slots[i].lastActivity = 0;
+    }
+    memset(_routeIndex, 0, sizeof(_routeIndex));
+}
+
+class AppWebServer::RateGate : public RequestHandler {
+public:
+    explicit RateGate(AppWebServer& server) : _server(server) {}
+
+    // Hiçbir isteği üstlenmez; yalnızca aramanın ilk adımında kovayı kontrol eder
+    virtual bool canHandle(HTTPMethod method, String uri) override {
+        _server.gateRequest(method, uri);
+        return false;
+    }
+
+private:
+    AppWebServer& _server;
+};
+
+void AppWebServer::begin() {
+    collectHeaders(collectedHeaderKeys, sizeof(collectedHeaderKeys) / sizeof(collectedHeaderKeys[0]));
+
+    // Kapı, server.on() ile eklenenlerden önce çalışsın diye listenin başına konur
+    RequestHandler* gate = new RateGate(*this);
+    gate->next(_firstHandler);
+    _firstHandler = gate;
+    if (_lastHandler == NULL) _lastHandler = gate;
+
+    WebServer::begin();
+}
+
+void AppWebServer::setRoutes(const Route* routes, size_t count, const RoutePrefix* prefixes, size_t prefixCount) {
+    if (count >= ROUTE_INDEX_SLOTS / 2) {
+        addLog("❌ Rota tablosu indeks için çok büyük: " + String(count), ERROR, "WEB");
+        count = ROUTE_INDEX_SLOTS / 2 - 1;
+    }
+    _routes = routes;
+    _routeCount = count;
+    _prefixes = prefixes;
+    _prefixCount = prefixCount;
+    memset(_routeIndex, 0, sizeof(_routeIndex));
+    routeStats.routes = count;
+    routeStats.maxProbe = 0;
+
+    // Açık adresleme, doğrusal yoklama
+    for (size_t i = 0; i < count; i++) {
+        if (findRoute(routes[i].method, routes[i].path) != NULL) {
+            routeStats.duplicates++;
+            addLog("⚠️ Yinelenen rota: " + String(routes[i].path), WARN, "WEB");
+            continue;
+        }
+        uint16_t probe = 0;
+        uint32_t slot = routes[i].key & (ROUTE_INDEX_SLOTS - 1);
+        while (_routeIndex[slot] != 0) {
+            slot = (slot + 1) & (ROUTE_INDEX_SLOTS - 1);
+            probe++;
+        }
+        _routeIndex[slot] = i + 1;
+        if (probe > routeStats.maxProbe) routeStats.maxProbe = probe;
+    }
+
+    initRouteMetrics(routeSlotCount());
+}
+
+const char* AppWebServer::routeSlotPath(size_t slot, HTTPMethod& method) const {
+    if (slot < _routeCount) {
+        method = _routes[slot].method;
+        return _routes[slot].path;
+    }
+    slot -= _routeCount;
+    if (slot < _prefixCount) {
+        method = _prefixes[slot].method;
+        return _prefixes[slot].prefix;
+    }
+    method = HTTP_ANY;
+    return "*";
+}
+
+const Route* AppWebServer::findRoute(HTTPMethod method, const char* path) const {
+    uint32_t key = routeKeyOf(method, path);
+    uint32_t slot = key & (ROUTE_INDEX_SLOTS - 1);
+    while (_routeIndex[slot] != 0) {
+        const Route& route = _routes[_routeIndex[slot] - 1];
+        if (route.key == key && route.method == method && strcmp(route.path, path) == 0) {
+            return &route;
+        }
+        slot = (slot + 1) & (ROUTE_INDEX_SLOTS - 1);
+    }
+    return NULL;
+}
+
+void AppWebServer::runCaptured(const Route& route, const String& query, CapturedResponse& out) {
+    String uri = _currentUri;
+    HTTPMethod method = _currentMethod;
+
+    // Dış isteğin argümanları (ör. paths) alt isteğe sızmasın: kendi query'si ayrıştırılır
+    RequestArgument* args = _currentArgs;
+    int argCount = _currentArgCount;
+    _currentArgs = NULL;
+    _currentArgCount = 0;
+    _parseArguments(query);
+
+    out.status = 0;
+    out.json = false;
+    out.body = "";
+    out.truncated = false;
+    _capture = &out;
+    _currentUri = route.path;
+    _currentMethod = route.method;
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+
+    route.handler();
+
+    _capture = NULL;
+    _captureAuthenticated = false;
+    delete[] _currentArgs;
+    _currentArgs = args;
+    _currentArgCount = argCount;
+    _responseHeaders = "";   // Alt isteğin yazılmamış sendHeader() başlıkları
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    _chunked = false;
+    _currentUri = uri;
+    _currentMethod = method;
+}
+
+RateClass AppWebServer::rateClassFor(HTTPMethod method, const String& uri) const {
+    const Route* route = findRoute(method, uri.c_str());
+    if (route != NULL) return route->rateClass;
+    for (size_t i = 0; i < _prefixCount; i++) {
+        if (_prefixes[i].method == method && uri.startsWith(_prefixes[i].prefix)) {
+            return _prefixes[i].rateClass;
+        }
+    }
+    return RATE_API;   // Yükleme ve 404
+}
+
+// _parseRequest istek satırını ayrıştırdıktan hemen sonra (RateGate). Kova boşsa okumaya
+// devam ettiği nesne boş, zaman aşımı 0 bir istemciyle değiştirilir: başlık ve gövde
+// okunmadan döner, serveSlot 429 yazar, soketi boşaltıp kapatır.
+void AppWebServer::gateRequest(HTTPMethod method, const String& uri) {
+    if (_rateChecked) return;
+    _rateChecked = true;
+    if (rateLimitAllow((uint32_t)_currentClient.remoteIP(), rateClassFor(method, uri), _retryAfter)) {
+        return;
+    }
+    _rateLimited = true;
+    _currentClient = WiFiClient();
+    _currentClient.setTimeout(0);
+}
+
+// Kapıdan geçmemiş istek için (ör. handler listesi dışı çağrı) aynı kontrol
+bool AppWebServer::rejectRateLimited(RateClass rateClass) {
+    if (_rateChecked) return false;
+    uint32_t retryAfter = 1;
+    if (rateLimitAllow((uint32_t)_currentClient.remoteIP(), rateClass, retryAfter)) {
+        return false;
+    }
+    sendRateLimited(retryAfter);
+    return true;
+}
+
+// Kovası boş istemciye kısa 429; bağlantı açık tutulmaz (havuz yuvası boşalır)
+void AppWebServer::sendRateLimited(uint32_t retryAfter) {
+    routeStats.limited++;
+    _keepAliveAllowed = false;
+    sendSecurityHeaders();
+    sendHeader("Retry-After", String(retryAfter));
+    send(429, "application/json", "{\"error\":\"Too many requests\"}");
+}
+
+// En büyük heap bloğu rotanın tahminine (ve yedek paya) yetmiyorsa handler çalışmadan 503.
+// Bağlantı kapatılır: soket tamponları da serbest kalsın.
+bool AppWebServer::rejectLowMemory(uint16_t heapKB, bool reserved) {
+    if (admissionAllow(heapKB, reserved)) {
+        return false;
+    }
+    _keepAliveAllowed = false;
+    sendSecurityHeaders();
+    sendHeader("Retry-After", String(ADMISSION_RETRY_AFTER));
+    send(503, "application/json", "{\"error\":\"Bellek yetersiz, daha sonra tekrar deneyin\"}");
+    return true;
+}
+
+// Handler süresini, boş heap değişimini ve yanıt sayaçlarını rota yuvasına yazar.
+// Worker'a devredilen isteğin kaydını yanıtı yazan worker yapar.
+class AppWebServer::RouteTimer {
+public:
+    RouteTimer(AppWebServer& server, size_t slot)
+        : _server(server), _slot(slot), _startUs(micros()), _startHeap(ESP.getFreeHeap()) {
+        server._metricsSlot = slot;
+        server._requestStartUs = _startUs;
+        server._metricsDeferred = false;
+        server._responseStatus = 0;
+        server._responseBytes = 0;
+        server._responseWrites = 0;
+        server._countBody = true;
+    }
+
+    ~RouteTimer() {
+        if (_server._metricsDeferred) return;
+        recordRouteMetrics(_slot, _server._responseStatus, _server._responseBytes, _server._responseWrites,
+                           micros() - _startUs, (int32_t)ESP.getFreeHeap() - (int32_t)_startHeap, false);
+    }
+
+private:
+    AppWebServer& _server;
+    size_t _slot;
+    unsigned long _startUs;
+    uint32_t _startHeap;
+};
+
+// İsteği tablodan, önek kuralından ya da WebServer'ın listesinden (yükleme, 404) yanıtlar
+void AppWebServer::dispatchRoute() {
+    uint32_t startCycles = ESP.getCycleCount();
+    const Route* route = findRoute(_currentMethod, _currentUri.c_str());
+    uint32_t cycles = ESP.getCycleCount() - startCycles;
+    routeStats.totalCycles += cycles;
+    if (cycles > routeStats.maxCycles) routeStats.maxCycles = cycles;
+
+    const RoutePrefix* prefix = NULL;
+    size_t slot;
+    if (route != NULL) {
+        slot = route - _routes;
+    } else {
+        for (size_t i = 0; i < _prefixCount; i++) {
+            if (_prefixes[i].method == _currentMethod && _currentUri.startsWith(_prefixes[i].prefix)) {
+                prefix = &_prefixes[i];
+                break;
+            }
+        }
+        slot = _routeCount + (prefix != NULL ? (size_t)(prefix - _prefixes) : _prefixCount);
+    }
+
+    RouteTimer timer(*this, slot);
+
+    if (route != NULL) {
+        routeStats.exact++;
+        if (!rejectRateLimited(route->rateClass) &&
+            !rejectLowMemory(route->heapKB, route->flags & ROUTE_FLAG_RESERVED)) {
+            route->handler();
+        }
+    } else if (prefix != NULL) {
+        routeStats.prefixed++;
+        if (!rejectRateLimited(prefix->rateClass) && !rejectLowMemory(ADMISSION_PREFIX_KB, false)) {
+            if (prefix->guard != NULL && !prefix->guard()) {
+                routeStats.rejected++;
+                send(401);
+            } else {
+                prefix->handler();
+            }
+        }
+    } else {
+        // Yükleme ve 404: tarama yapan istemci de API kovasından düşer
+        routeStats.fallback++;
+        if (!rejectRateLimited(RATE_API) && !rejectLowMemory(ADMISSION_FALLBACK_KB, false)) {
+            _handleRequest();   // Yanıtı kendisi sonlandırır
+            return;
+        }
+    }
+
+    _finalizeResponse();
+    _currentUri = "";
+}
+
+// WebServer'daki FunctionRequestHandler::canHandle(method, String uri) karşılığı:
+// sanal çağrı yerine noinline, yol yine değerle (kopyalanarak) geçer
+static bool __attribute__((noinline)) linearCanHandle(HTTPMethod routeMethod, const String& routePath,
+                                                      HTTPMethod method, String uri) {
+    return routeMethod == method && routePath == uri;
+}
+
+// Aynı yollar: özetli arama vs. WebServer'ın handler listesini dolaşması
+RouteBenchResult AppWebServer::benchmarkRoutes(uint32_t rounds) {
+    RouteBenchResult result = {(uint16_t)_routeCount, rounds, 0, 0, 0};
+    if (_routeCount == 0 || rounds == 0) return result;
+
+    String* paths = new String[_routeCount];
+    for (size_t i = 0; i < _routeCount; i++) {
+        paths[i] = _routes[i].path;
+    }
+
+    uint64_t hashedCycles = 0;
+    uint64_t linearCycles = 0;
+    uint32_t worstCycles = 0;
+    volatile size_t sink = 0;   // Derleyici aramaları atmasın
+
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < _routeCount; i++) {
+            // İstek yolu her seferinde String olarak gelir
+            String uri = paths[i];
+            HTTPMethod method = _routes[i].method;
+
+            uint32_t start = ESP.getCycleCount();
+            sink += findRoute(method, uri.c_str()) != NULL;
+            hashedCycles += ESP.getCycleCount() - start;
+
+            start = ESP.getCycleCount();
+            for (size_t j = 0; j < _routeCount; j++) {
+                if (linearCanHandle(_routes[j].method, paths[j], method, uri)) {
+                    sink += j;
+                    break;
+                }
+            }
+            uint32_t cycles = ESP.getCycleCount() - start;
+            linearCycles += cycles;
+            if (i == _routeCount - 1 && cycles > worstCycles) worstCycles = cycles;
+        }
+        vTaskDelay(1);
+    }
+    delete[] paths;
+
+    uint64_t lookups = (uint64_t)rounds * _routeCount;
+    result.hashedAvgCycles = hashedCycles / lookups;
+    result.linearAvgCycles = linearCycles / lookups;
+    result.linearWorstCycles = worstCycles;
+    return result;
+}
+
+void AppWebServer::setKeepAlive(unsigned long idleMs, uint16_t maxRequests) {
+    _idleTimeoutMs = idleMs;
+    _maxRequests = maxRequests > 0 ? maxRequests : 1;
+}
+
+void AppWebServer::closeSlot(KeepAliveSlot& slot, unsigned long& reason) {
+    slot.client.stop();
+    slot.client = WiFiClient();
+    slot.active = false;
+    reason++;
+    keepAliveStats.open--;
+}
+
+// Yeni bağlantıyı havuza al; havuz doluysa en uzun süredir boşta olanı kapat
+void AppWebServer::acceptClient() {
+    if (!_server.hasClient()) return;
+
+    // Boş yuva yoksa en eski boştaki bağlantı kapatılır. Okunmamış isteği olan yuvaya
+    // dokunulmaz; hepsi meşgulse yeni bağlantı dinleme kuyruğunda sırasını bekler.
+    KeepAliveSlot* target = NULL;
+    for (int i = 0; i < KEEPALIVE_MAX_CONNECTIONS; i++) {
+        if (!_slots[i].active) {
+            target = &_slots[i];
+            break;
+        }
+        if (_slots[i].client.available() > 0) continue;
+        if (target == NULL || _slots[i].lastActivity < target->lastActivity) {
+            target = &_slots[i];
+        }
+    }
+    if (target == NULL) return;
+
+    WiFiClient client = _server.available();
+    if (!client) return;
+
+    if (target->active) {
+        if (target->client.connected()) {
+            closeSlot(*target, keepAliveStats.evicted);
+        } else {
+            closeSlot(*target, keepAliveStats.closedByClient);
+        }
+    }
+
+    target->client = client;
+    target->lastActivity = millis();
+    target->requests = 0;
+    target->active = true;
+    keepAliveStats.connections++;
+    keepAliveStats.open++;
+}
+
+bool AppWebServer::requestWantsKeepAlive() {
+    String connection = header("Connection");
+    if (connection.equalsIgnoreCase("close")) return false;
+    // HTTP/1.1 varsayılan olarak kalıcıdır, HTTP/1.0 açıkça istemelidir
+    return _currentVersion >= 1 || connection.equalsIgnoreCase("keep-alive");
+}
+
+// Bağlantının tamponundaki istekleri sırayla yanıtla (pipelining). Yanıtlar aynı task'ta
+// sırayla yazıldığı için istek sırası korunur.
+void AppWebServer::serveSlot(KeepAliveSlot& slot) {
+    for (int handled = 0; handled < KEEPALIVE_PIPELINE_DEPTH && slot.client.available(); handled++) {
+        _currentClient = slot.client;
+        _rateChecked = false;
+        _rateLimited = false;
+        bool parsed = _parseRequest(_currentClient);
+        if (_rateLimited) {
+            // Başlıklar/gövde sokette okunmadan kaldı: 429 sonrası boşaltılıp kapatılır
+            _currentClient = slot.client;
+            _contentLength = CONTENT_LENGTH_NOT_SET;
+            _headerPending = true;
+            _keepAliveAllowed = false;
+            _responseKeepAlive = false;
+            sendRateLimited(_retryAfter);
+            _headerPending = false;
+            _currentClient = WiFiClient();
+            drainRejectedClient(slot.client);
+            closeSlot(slot, keepAliveStats.closedByServer);
+            return;
+        }
+        if (!parsed) {
+            _currentClient = WiFiClient();
+            closeSlot(slot, keepAliveStats.closedByServer);
+            return;
+        }
+        _currentClient.setTimeout(HTTP_MAX_SEND_WAIT / 1000);
+        _contentLength = CONTENT_LENGTH_NOT_SET;
+
+        slot.requests++;
+        keepAliveStats.requests++;
+        if (slot.requests > 1) keepAliveStats.reusedRequests++;
+        if (handled > 0) keepAliveStats.pipelined++;
+
+        _keepAliveAllowed = _idleTimeoutMs > 0 && slot.requests < _maxRequests && requestWantsKeepAlive();
+        _remainingRequests = _maxRequests - slot.requests;
+        _headerPending = true;
+        _responseKeepAlive = false;
+
+        dispatchRoute();
+
+        _headerPending = false;
+        _currentClient = WiFiClient();
+        _currentUpload.reset();
+        _currentStatus = HC_NONE;
+
+        // İstek ertelendiyse ya da ham yanıtla bitirildiyse soket DeferredRequest içindeki
+        // kopyaya kalır; havuz kendi referansını bırakır. Tampondaki sonraki istekler o
+        // yanıtla birlikte kapanır (ertelenen yanıt Connection: close gönderir).
+        if (_detachCurrent) {
+            _detachCurrent = false;
+            _responseHeaders = "";   // Yazılmamış sendHeader() başlıkları sonraki yanıta taşınmasın
+            slot.client = WiFiClient();
+            slot.active = false;
+            keepAliveStats.handedOff++;
+            keepAliveStats.open--;
+            return;
+        }
+
+        if (!_responseKeepAlive) {
+            closeSlot(slot, slot.requests >= _maxRequests ? keepAliveStats.closedMaxRequests
+                                                          : keepAliveStats.closedByServer);
+            return;
+        }
+        slot.lastActivity = millis();
+    }
+}
+
+void AppWebServer::handleClient() {
+    acceptClient();
+
+    for (int i = 0; i < KEEPALIVE_MAX_CONNECTIONS; i++) {
+        KeepAliveSlot& slot = _slots[i];
+        if (!slot.active) continue;
+
+        if (slot.client.available()) {
+            serveSlot(slot);
+        } else if (!slot.client.connected()) {
+            closeSlot(slot, keepAliveStats.closedByClient);
+        } else if (millis() - slot.lastActivity > _idleTimeoutMs) {
+            closeSlot(slot, keepAliveStats.closedIdle);
+        }
+    }
+}
+
+size_t AppWebServer::_currentClientWrite(const char* b, size_t l) {
+    if (_capture != NULL) {
+        // İlk yazım başlıktır: yalnızca kod ve içerik tipi alınır
+        if (_capture->status == 0 && strncmp(b, "HTTP/1.", 7) == 0) {
+            _capture->status = atoi(b + 9);
+            _capture->json = strstr(b, "Content-Type: application/json") != NULL;
+        } else if (_capture->limit > 0 && _capture->body.length() + l > _capture->limit) {
+            _capture->truncated = true;
+            _capture->body = "";
+        } else if (!_capture->truncated) {
+            _capture->body.concat(b, l);
+        }
+        return l;
+    }
+    _responseWrites++;
+    if (!_headerPending) {
+        if (_countBody) _responseBytes += l;
+        return WebServer::_currentClientWrite(b, l);
+    }
+    _headerPending = false;
+    if (strncmp(b, "HTTP/1.", 7) != 0) {
+        _responseBytes += l;
+        return WebServer::_currentClientWrite(b, l);
+    }
+
+    // İlk yazım _prepareHeader çıktısıdır, sendCoalesced() ile gövde de arkasındadır.
+    // Gövde uzunluğu belli değilse (HTTP/1.0'a Content-Length'siz yanıt) sonu ancak
+    // bağlantı kapanınca anlaşılır - kapalı kalır.
+    String head;
+    head.concat(b, l);
+    int lengthPos = head.indexOf("Content-Length: ");
+    int headEnd = head.indexOf("\r\n\r\n");
+    size_t headLength = headEnd < 0 ? l : headEnd + 4;
+    if (headEnd >= 0 && lengthPos > headEnd) lengthPos = -1;   // Gövdedeki metin sayılmaz
+    _responseStatus = atoi(b + 9);
+    // streamFile() gövdeyi sunucuyu atlayarak yazar: uzunluk biliniyorsa başlıktan alınır
+    _countBody = lengthPos < 0;
+    _responseBytes += lengthPos < 0 ? l : headLength + strtoul(b + lengthPos + 16, NULL, 10);
+
+    int pos = head.indexOf("Connection: close\r\n");
+    if (headEnd >= 0 && pos > headEnd) pos = -1;
+    bool delimited = _chunked || lengthPos >= 0;
+    if (!_keepAliveAllowed || pos < 0 || !delimited) {
+        return WebServer::_currentClientWrite(b, l);
+    }
+
+    head = head.substring(0, pos) + "Connection: keep-alive\r\nKeep-Alive: timeout=" +
+           String(_idleTimeoutMs / 1000) + ", max=" + String(_remainingRequests) + "\r\n" +
+           head.substring(pos + 19);
+    _responseKeepAlive = true;
+    return WebServer::_currentClientWrite(head.c_str(), head.length()) > 0 ? l : 0;
+}
+
+void AppWebServer::fillRequest(DeferredRequest& request, DeferredHandler handler, unsigned long budgetMs) {
+    request.client = _currentClient;
+    request.uri = uri();
+    request.argCount = 0;
+    for (int i = 0; i < args() && request.argCount < DEFERRED_MAX_ARGS; i++) {
+        request.argNames[request.argCount] = argName(i);
+        request.argValues[request.argCount] = arg(i);
+        request.argCount++;
+    }
+    request.cancel.isAlive = isDeferredClientAlive;
+    request.cancel.context = &request.client;
+    request.cancel.deadline = budgetMs > 0 ? millis() + budgetMs : 0;
+    request.cancel.cancelled = false;
+    request.cancel.expired = false;
+    request.handler = handler;
+    request.queuedAt = millis();
+    request.responded = false;
+    request.metricsSlot = _metricsSlot;
+    request.startUs = _requestStartUs;
+    request.status = 0;
+    request.bytesSent = 0;
+    request.acceptsGzip = requestAcceptsGzip();
+    request.writes = 0;
+    request.inlineReply = false;
+}
+
+bool AppWebServer::deferRequest(DeferredHandler handler, unsigned long budgetMs) {
+    if (deferredQueue == NULL) {
+        sendSecurityHeaders();
+        send(503, "application/json", "{\"error\":\"Deferred responses not initialized\"}");
+        return false;
+    }
+
+    DeferredRequest* request = new DeferredRequest();
+    fillRequest(*request, handler, budgetMs);
+
+    if (xQueueSend(deferredQueue, &request, 0) != pdTRUE) {
+        delete request;
+        portENTER_CRITICAL(&deferredStatsMux);
+        deferredStats.rejected++;
+        portEXIT_CRITICAL(&deferredStatsMux);
+        sendSecurityHeaders();
+        sendHeader("Retry-After", "1");
+        send(503, "application/json", "{\"error\":\"UART kuyruğu dolu\"}");
+        return false;
+    }
+
+    portENTER_CRITICAL(&deferredStatsMux);
+    deferredStats.queued++;
+    portEXIT_CRITICAL(&deferredStatsMux);
+    _detachCurrent = true;
+    _metricsDeferred = true;
+    return true;
+}
+
+WiFiClient AppWebServer::detachClient() {
+    _detachCurrent = true;
+    return _currentClient;
+}
+
+void AppWebServer::completeInline(DeferredHandler handler) {
+    DeferredRequest request;
+    fillRequest(request, handler, 0);
+    request.inlineReply = true;
+    handler(request);
+
+    // Yanıt yazılmadıysa (istemci ayrıldı) bağlantı bırakılır
+    if (!request.responded) {
+        request.client.stop();
+        _detachCurrent = true;
+    }
+    portENTER_CRITICAL(&deferredStatsMux);
+    deferredStats.inlineCompleted++;
+    portEXIT_CRITICAL(&deferredStatsMux);
+}
+
+bool AppWebServer::requestAcceptsGzip() {
+    return acceptsGzipEncoding(header("Accept-Encoding"));
+}
+
+String AppWebServer::deferredHeader(int code, const char* contentType, bool chunked, size_t length, bool gzip) {
+    String head = "HTTP/1.1 " + String(code) + " " + _responseCodeToString(code) + "\r\n";
+    head += "Content-Type: " + String(contentType) + "\r\n";
+    if (gzip) {
+        head += "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\n";
+    }
+    if (chunked) {
+        head += "Transfer-Encoding: chunked\r\n";
+    } else {
+        head += "Content-Length: " + String(length) + "\r\n";
+    }
+    head += "Connection: close\r\n";
+    for (int i = 0; i < SECURITY_HEADER_COUNT; i++) {
+        head += String(securityHeaders[i][0]) + ": " + securityHeaders[i][1] + "\r\n";
+    }
+    head += "\r\n";
+    return head;
+}
+
+// Ertelenmiş yanıtın sokete yazımı - bayt ve yazım sayısı rota metriklerine gider
+static void writeDeferred(DeferredRequest& request, const uint8_t* data, size_t length) {
+    request.client.write(data, length);
+    request.bytesSent += length;
+    request.writes++;
+}
+
+// Parça çerçevesi (boyut satırı, veri, CRLF) tek tamponda; bellek yoksa false
+static bool buildChunkFrame(String& frame, const char* data, size_t length) {
+    char size[12];
+    int n = snprintf(size, sizeof(size), "%x\r\n", (unsigned int)length);
+    if (!frame.reserve(n + length + 2)) return false;
+    frame.concat(size, n);
+    frame.concat(data, length);
+    frame.concat("\r\n", 2);
+    return true;
+}
+
+void AppWebServer::sendDeferred(DeferredRequest& request, int code, const char* contentType, const String& content) {
+    if (request.inlineReply) {
+        sendSecurityHeaders();
+        send(code, contentType, content);
+        request.responded = true;
+        request.status = code;
+        return;
+    }
+
+    String head = deferredHeader(code, contentType, false, content.length());
+
+    if (content.length() <= RESPONSE_COALESCE_MAX && head.reserve(head.length() + content.length())) {
+        head += content;
+        writeDeferred(request, (const uint8_t*)head.c_str(), head.length());
+    } else {
+        writeDeferred(request, (const uint8_t*)head.c_str(), head.length());
+        writeDeferred(request, (const uint8_t*)content.c_str(), content.length());
+    }
+    request.client.stop();
+    request.responded = true;
+    request.status = code;
+}
+
+bool AppWebServer::deferredCancelled(DeferredRequest& request) {
+    if (!request.cancel.cancelled) return false;
+
+    // Bütçe doldu ama tarayıcı hâlâ bekliyor: sessizce kapatmak yerine zaman aşımı bildirilir
+    if (request.cancel.expired && request.client.connected()) {
+        sendDeferred(request, 504, "application/json",
+            "{\"success\":false,\"error\":\"UART işlemi süre sınırını aştı\"}");
+    }
+    return true;
+}
+
+void AppWebServer::sendSecurityHeaders() {
+    if (_responseHeaders.indexOf(securityHeaders[0][0]) >= 0) return;
+    for (int i = 0; i < SECURITY_HEADER_COUNT; i++) {
+        sendHeader(securityHeaders[i][0], securityHeaders[i][1]);
+    }
+}
+
+void AppWebServer::sendCoalesced(int code, const char* contentType, const char* content, size_t length) {
+    String response;
+    _prepareHeader(response, code, contentType, length);
+    // setContentLength(CONTENT_LENGTH_UNKNOWN) sonrası gövde parça çerçevesiyle gitmeli
+    if (_capture == NULL && !_chunked && length <= RESPONSE_COALESCE_MAX &&
+        response.reserve(response.length() + length)) {
+        response.concat(content, length);
+        _currentClientWrite(response.c_str(), response.length());
+        return;
+    }
+    _currentClientWrite(response.c_str(), response.length());
+    if (length > 0) {
+        sendContent(content, length);
+    }
+}
+
+void AppWebServer::send(int code, const char* content_type, const String& content) {
+    sendCoalesced(code, content_type, content.c_str(), content.length());
+}
+
+void AppWebServer::send(int code, char* content_type, const String& content) {
+    sendCoalesced(code, content_type, content.c_str(), content.length());
+}
+
+void AppWebServer::send(int code, const String& content_type, const String& content) {
+    sendCoalesced(code, content_type.c_str(), content.c_str(), content.length());
+}
+
+void AppWebServer::send(int code, const char* content_type, const char* content) {
+    sendCoalesced(code, content_type, content, content != NULL ? strlen(content) : 0);
+}
+
+void AppWebServer::send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength) {
+    sendCoalesced(code, content_type, content, contentLength);
+}
+
+void AppWebServer::sendContent(const String& content) {
+    sendContent(content.c_str(), content.length());
+}
+
+void AppWebServer::sendContent(const char* content, size_t contentLength) {
+    String frame;
+    if (!_chunked || _capture != NULL || !buildChunkFrame(frame, content, contentLength)) {
+        WebServer::sendContent(content, contentLength);
+        return;
+    }
+    _currentClientWrite(frame.c_str(), frame.length());
+    if (contentLength == 0) {
+        _chunked = false;   // Son parça yazıldı (WebServer ile aynı)
+    }
+}
+
+void AppWebServer::sendJson(int code, const JsonDocument& doc) {
+    if (_capture != NULL) {
+        // Parça çerçevesi olmadan doğrudan yakalama tamponuna
+        _capture->status = code;
+        _capture->json = true;
+        if (_capture->limit > 0 && measureJson(doc) > _capture->limit) {
+            _capture->truncated = true;
+        } else {
+            serializeJson(doc, _capture->body);
+        }
+        _responseHeaders = "";
+        return;
+    }
+    JsonResponseStream stream(*this, code, "application/json");
+    serializeJson(doc, stream);
+    stream.end();
+}
+
+void AppWebServer::sendDeferredJson(DeferredRequest& request, int code, const JsonDocument& doc) {
+    if (request.inlineReply) {
+        sendSecurityHeaders();
+        sendJson(code, doc);
+        request.responded = true;
+        request.status = code;
+        return;
+    }
+    JsonResponseStream stream(*this, request, code, "application/json");
+    serializeJson(doc, stream);
+    stream.end();
+}
+
+JsonResponseStream::JsonResponseStream(AppWebServer& server, int code, const char* contentType)
+    : _server(server), _request(NULL), _code(code), _contentType(contentType),
+      _headerSent(false), _chunked(false), _used(0), _total(0),
+      _gzipAllowed(server.requestAcceptsGzip()), _gzip(NULL) {}
+
+JsonResponseStream::JsonResponseStream(AppWebServer& server, DeferredRequest& request, int code,
+                                       const char* contentType)
+    : _server(server), _request(&request), _code(code), _contentType(contentType),
+      _headerSent(false), _chunked(false), _used(0), _total(0),
+      _gzipAllowed(request.acceptsGzip), _gzip(NULL) {}
+
+JsonResponseStream::~JsonResponseStream() {
+    delete _gzip;
+}
+
+size_t JsonResponseStream::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t JsonResponseStream::write(const uint8_t* data, size_t length) {
+    size_t written = 0;
+    while (written < length) {
+        if (_used == JSON_STREAM_BUFFER) {
+            flushChunk();
+        }
+        size_t n = length - written;
+        if (n > JSON_STREAM_BUFFER - _used) n = JSON_STREAM_BUFFER - _used;
+        memcpy(_buffer + _used, data + written, n);
+        _used += n;
+        written += n;
+    }
+    _total += length;
+    return length;
+}
+
+void JsonResponseStream::writeHeader(bool chunked, size_t length) {
+    _headerSent = true;
+    _chunked = chunked;
+    if (_request != NULL) {
+        String head = _server.deferredHeader(_code, _contentType, chunked, length, _gzip != NULL);
+        writeDeferred(*_request, (const uint8_t*)head.c_str(), head.length());
+        _request->status = _code;
+    } else {
+        // Başlık sunucudan geçer (keep-alive, güvenlik başlıkları); HTTP/1.0 istemcide
+        // WebServer parça çerçevesi eklemez, gövde bağlantı kapanınca biter
+        if (_gzip != NULL) {
+            _server.sendHeader("Content-Encoding", "gzip");
+            _server.sendHeader("Vary", "Accept-Encoding");
+        }
+        _server.setContentLength(chunked ? CONTENT_LENGTH_UNKNOWN : length);
+        _server.send(_code, _contentType, "");
+    }
+}
+
+void JsonResponseStream::writeBody(const uint8_t* data, size_t length) {
+    if (_request == NULL) {
+        _server.sendContent((const char*)data, length);
+        return;
+    }
+    String frame;
+    if (!_chunked) {
+        writeDeferred(*_request, data, length);
+    } else if (buildChunkFrame(frame, (const char*)data, length)) {
+        writeDeferred(*_request, (const uint8_t*)frame.c_str(), frame.length());
+    } else {
+        char size[12];
+        int n = snprintf(size, sizeof(size), "%x\r\n", (unsigned int)length);
+        writeDeferred(*_request, (const uint8_t*)size, n);
+        writeDeferred(*_request, data, length);
+        writeDeferred(*_request, (const uint8_t*)"\r\n", 2);
+    }
+}
+
+// Tampona sığan yanıt: başlık ve gövde tek yazımda, Content-Length ile
+void JsonResponseStream::writeSingle() {
+    _headerSent = true;
+    if (_request == NULL) {
+        _server.sendCoalesced(_code, _contentType, (const char*)_buffer, _used);
+        return;
+    }
+    String response = _server.deferredHeader(_code, _contentType, false, _used);
+    if (response.reserve(response.length() + _used)) {
+        response.concat((const char*)_buffer, _used);
+        writeDeferred(*_request, (const uint8_t*)response.c_str(), response.length());
+    } else {
+        writeDeferred(*_request, (const uint8_t*)response.c_str(), response.length());
+        writeDeferred(*_request, _buffer, _used);
+    }
+    _request->status = _code;
+}
+
+// Sıkıştırılmış çıktı parça parça gövdeye yazılır
+void JsonResponseStream::gzipSink(void* context, const uint8_t* data, size_t length) {
+    JsonResponseStream* stream = static_cast<JsonResponseStream*>(context);
+    stream->writeBody(data, length);
+    jsonStreamStats.chunks++;
+}
+
+void JsonResponseStream::flushChunk() {
+    if (!_headerSent) {
+        // Tampon taştı: yanıt büyük, sıkıştırmaya değer. Bellek sıkışıksa ya da
+        // kodlayıcı ayrılamazsa düz gönderilir.
+        if (_gzipAllowed && !admissionDegraded()) {
+            _gzip = new (std::nothrow) GzipEncoder(gzipSink, this);
+        }
+        if (_gzip == NULL) {
+            gzipStats.skipped++;
+        }
+        writeHeader(true, 0);
+    }
+    if (_used > 0) {
+        if (_gzip != NULL) {
+            _gzip->write(_buffer, _used);
+        } else {
+            writeBody(_buffer, _used);
+            jsonStreamStats.chunks++;
+        }
+        _used = 0;
+    }
+}
+
+size_t JsonResponseStream::end() {
+    if (!_headerSent) {
+        // Tamamı tampona sığdı: tek parça, Content-Length ile
+        writeSingle();
+        _used = 0;
+        jsonStreamStats.single++;
+    } else {
+        flushChunk();
+        if (_gzip != NULL) {
+            _gzip->finish();
+            gzipStats.responses++;
+            gzipStats.inBytes += _gzip->inBytes();
+            gzipStats.outBytes += _gzip->outBytes();
+            gzipStats.cycles += _gzip->cycles();
+            if (_gzip->cycles() > gzipStats.maxCycles) {
+                gzipStats.maxCycles = _gzip->cycles();
+            }
+            delete _gzip;
+            _gzip = NULL;
+        }
+        writeBody((const uint8_t*)"", 0);   // Son parça (0\r\n\r\n)
+        jsonStreamStats.chunked++;
+    }
+    if (_total > jsonStreamStats.maxBytes) {
+        jsonStreamStats.maxBytes = _total;
+    }
+
+    if (_request != NULL) {
+        _request->client.stop();
+        _request->responded = true;
+    }
+    return _total;
+}
+
+// Kuyruktaki istekleri sırayla çalıştırır - UART tek hat olduğu için tek worker yeterli
+static void deferredResponseTask(void* parameter) {
+    DeferredRequest* request;
+    while (true) {
+        if (xQueueReceive(deferredQueue, &request, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        unsigned long waitMs = millis() - request->queuedAt;
+        portENTER_CRITICAL(&deferredStatsMux);
+        if (waitMs > deferredStats.maxQueueWaitMs) {
+            deferredStats.maxQueueWaitMs = waitMs;
+        }
+        portEXIT_CRITICAL(&deferredStatsMux);
+
+        // Sırası gelmeden ayrılan istemci için UART'a hiç gidilmez; kuyrukta süresi dolan 504 alır
+        uint32_t startHeap = ESP.getFreeHeap();
+        if (!uartTokenCancelled(&request->cancel)) {
+            request->handler(*request);
+        } else {
+            server.deferredCancelled(*request);
+        }
+        recordRouteMetrics(request->metricsSlot, request->status, request->bytesSent, request->writes,
+                           micros() - request->startUs,
+                           (int32_t)ESP.getFreeHeap() - (int32_t)startHeap, true);
+
+        if (!request->responded) {
+            request->client.stop();
+        }
+        portENTER_CRITICAL(&deferredStatsMux);
+        if (request->responded) {
+            deferredStats.completed++;
+        } else {
+            deferredStats.abandoned++;
+        }
+        portEXIT_CRITICAL(&deferredStatsMux);
+        delete request;
+    }
+}
+
+void initDeferredResponses() {
+    if (deferredQueue != NULL) return;
+
+    deferredQueue = xQueueCreate(DEFERRED_QUEUE_LENGTH, sizeof(DeferredRequest*));
+    xTaskCreatePinnedToCore(deferredResponseTask, "HTTPDefer", DEFERRED_TASK_STACK, NULL, 1,
+                            &deferredTaskHandle, 1);
+    addLog("✅ Ertelenmiş HTTP yanıtları hazır (kuyruk: " + String(DEFERRED_QUEUE_LENGTH) + ")", SUCCESS, "WEB");
+}
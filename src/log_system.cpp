@@ -1,11 +1,24 @@
 #include "log_system.h"
 #include <time.h>
+#include <freertos/semphr.h>
+#include "state_version.h"
 
 // log_system.h'de 'extern' olarak bildirilen global değişkenlerin
 // gerçek tanımlamaları burada yapılır.
 LogEntry logs[50];
 int logIndex = 0;
 int totalLogs = 0;
+unsigned long logSequence = 0;
+
+static SemaphoreHandle_t logMutex = NULL;
+
+void lockLogs() {
+    if (logMutex != NULL) xSemaphoreTake(logMutex, portMAX_DELAY);
+}
+
+void unlockLogs() {
+    if (logMutex != NULL) xSemaphoreGive(logMutex);
+}
 
 // NTP'den geçerli zaman alınamazsa kullanılacak zaman formatı
 String getFormattedTimestampFallback() {
@@ -37,6 +50,9 @@ String getFormattedTimestamp() {
 
 // Log sistemini başlatan fonksiyon
 void initLogSystem() {
+    if (logMutex == NULL) {
+        logMutex = xSemaphoreCreateMutex();
+    }
     for (int i = 0; i < 50; i++) {
         logs[i].message = "";
     }
@@ -48,7 +64,10 @@ void initLogSystem() {
 
 // Yeni bir log ekleyen ana fonksiyon
 void addLog(const String& msg, LogLevel level, const String& source) {
-    logs[logIndex].timestamp = getFormattedTimestamp();
+    String timestamp = getFormattedTimestamp();
+
+    lockLogs();
+    logs[logIndex].timestamp = timestamp;
     logs[logIndex].message = msg;
     logs[logIndex].level = level;
     logs[logIndex].source = source;
@@ -58,13 +77,29 @@ void addLog(const String& msg, LogLevel level, const String& source) {
     if (totalLogs < 50) {
         totalLogs++;
     }
+    logSequence++;
+    unlockLogs();
+    bumpStateVersion(STATE_LOGS);
 
     // Sadece DEBUG_MODE tanımlıysa seri porta yazdır
     #ifdef DEBUG_MODE
-    Serial.println("[" + getFormattedTimestamp() + "] [" + logLevelToString(level) + "] [" + source + "] " + msg);
+    Serial.println("[" + timestamp + "] [" + logLevelToString(level) + "] [" + source + "] " + msg);
     #endif
 }
 
+// En yeni kayıt logSequence numaralıdır ve logIndex'in bir gerisindedir
+bool getLogBySequence(unsigned long seq, LogEntry& out) {
+    bool found = false;
+    lockLogs();
+    unsigned long back = logSequence - seq;
+    if (seq > 0 && seq <= logSequence && back < (unsigned long)totalLogs) {
+        out = logs[(logIndex - 1 - (int)back + 50) % 50];
+        found = true;
+    }
+    unlockLogs();
+    return found;
+}
+
 // Log seviyesini string'e çeviren yardımcı fonksiyon
 String logLevelToString(LogLevel level) {
     switch (level) {
@@ -79,10 +114,13 @@ String logLevelToString(LogLevel level) {
 
 // Tüm logları temizleyen fonksiyon
 void clearLogs() {
+    lockLogs();
     for (int i = 0; i < 50; i++) {
         logs[i].message = "";
     }
     logIndex = 0;
     totalLogs = 0;
+    unlockLogs();
+    bumpStateVersion(STATE_LOGS);
     addLog("Log kayıtları temizlendi.", WARN, "SYSTEM");
 }
\ No newline at end of file
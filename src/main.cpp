@@ -12,6 +12,11 @@
 #include "backup_restore.h"
 #include "datetime_handler.h"
 #include "fault_parser.h"
+#include "dspic_cache.h"
+#include "static_assets.h"
+#include "state_version.h"
+#include "event_stream.h"
+#include "uart_console.h"
 
 // External fonksiyonlar
 extern void checkTimeSync();
@@ -26,6 +31,7 @@ TaskHandle_t uartTaskHandle = NULL;
 void webServerTask(void *parameter) {
     while(true) {
         server.handleClient();
+        processEventStream();
         vTaskDelay(1);
     }
 }
@@ -35,6 +41,7 @@ void uartTask(void *parameter) {
     while(true) {
         checkTimeSync();
         checkUARTHealth();
+        processDsPICCacheRefresh();
         vTaskDelay(1000); // 1 saniye
     }
 }
@@ -65,11 +72,17 @@ void setup() {
         ESP.restart();
     }
     
+    initStateVersions();
     initLogSystem();
     loadSettings();
     loadNetworkConfig();
     initEthernetAdvanced();
     initUART();
+    initDateTimeHandler();
+    initDsPICCache();
+    initDeferredResponses();
+    initUARTConsole();
+    initStaticAssets();
     setupWebRoutes();
     loadPasswordPolicy();
     initMDNS();
@@ -102,4 +115,4 @@ void loop() {
     }
     
     vTaskDelay(1000); // Ana döngüyü yavaşlat
-}
\ No newline at end of file
+}
\ No newline at end of file
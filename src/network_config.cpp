@@ -3,10 +3,16 @@
 #include <Preferences.h>
 #include "log_system.h"
 #include "settings.h"
+#include "state_version.h"
 
 // Global settings değişkenini kullan
 extern Settings settings;
 
+// Bağlantı/IP değişince /api/network yanıtı değişir
+static void onEthernetEvent(arduino_event_id_t event) {
+    bumpStateVersion(STATE_NETWORK);
+}
+
 // Network ayarlarını yükle
 void loadNetworkConfig() {
     // Settings zaten loadSettings() içinde yükleniyor
@@ -18,6 +24,10 @@ void loadNetworkConfig() {
 void initEthernetAdvanced() {
     addLog("Ethernet başlatılıyor...", INFO, "ETH");
     
+    WiFi.onEvent(onEthernetEvent, ARDUINO_EVENT_ETH_CONNECTED);
+    WiFi.onEvent(onEthernetEvent, ARDUINO_EVENT_ETH_DISCONNECTED);
+    WiFi.onEvent(onEthernetEvent, ARDUINO_EVENT_ETH_GOT_IP);
+    
     // WT32-ETH01 için doğru pinler
     ETH.begin(1, 16, 23, 18, ETH_PHY_LAN8720, ETH_CLOCK_GPIO17_OUT);
     
@@ -2,6 +2,7 @@
 #include "ntp_handler.h"
 #include "log_system.h"
 #include "uart_handler.h"
+#include "state_version.h"
 #include <Preferences.h>
 
 // Global değişkenler
@@ -51,6 +52,13 @@ void sendNTPConfigToBackend() {
         return;
     }
     
+    // Dört komut tek seferde, araya başka iş girmeden gönderilsin.
+    // Komutlar arası boşluğu uart_pacer ayarlar (clearUARTBuffer içinde).
+    if (!uartAcquire(UART_PRIO_NORMAL)) {
+        addLog("❌ UART hattı meşgul, NTP ayarları gönderilemedi", ERROR, "NTP");
+        return;
+    }
+    
     String response;
     bool allSuccess = true;
     
@@ -68,8 +76,6 @@ void sendNTPConfigToBackend() {
             allSuccess = false;
         }
         
-        delay(50); // Komutlar arası bekleme
-        
         // NTP1 ikinci komut: 001002y
         String cmd2 = ntp1_part2 + "y";
         if (sendCustomCommand(cmd2, response, 1000)) {
@@ -85,8 +91,6 @@ void sendNTPConfigToBackend() {
     
     // NTP2 varsa gönder
     if (strlen(ntpConfig.ntpServer2) > 0) {
-        delay(50);
-        
         String ntp2_part1, ntp2_part2;
         formatIPForDsPIC(String(ntpConfig.ntpServer2), ntp2_part1, ntp2_part2);
         
@@ -100,8 +104,6 @@ void sendNTPConfigToBackend() {
                 allSuccess = false;
             }
             
-            delay(50);
-            
             // NTP2 ikinci komut: 001001x
             String cmd4 = ntp2_part2 + "x";
             if (sendCustomCommand(cmd4, response, 1000)) {
@@ -116,6 +118,8 @@ void sendNTPConfigToBackend() {
         }
     }
     
+    uartRelease();
+    
     if (allSuccess) {
         addLog("✅ Tüm NTP ayarları başarıyla dsPIC33EP'ye gönderildi", SUCCESS, "NTP");
     } else {
@@ -206,6 +210,7 @@ bool saveNTPSettings(const String& server1, const String& server2, int timezone)
     ntpConfig.timezone = timezone;
     ntpConfig.enabled = true;
     ntpConfigured = true;
+    bumpStateVersion(STATE_NTP);
     
     addLog("✅ NTP ayarları kaydedildi", SUCCESS, "NTP");
     
@@ -263,6 +268,7 @@ void resetNTPSettings() {
     preferences.end();
     
     ntpConfigured = false;
+    bumpStateVersion(STATE_NTP);
     
     addLog("NTP ayarları sıfırlandı", INFO, "NTP");
 }
\ No newline at end of file
@@ -4,9 +4,9 @@
 #include "log_system.h"
 #include "crypto_utils.h"
 #include "auth_system.h"  // checkSession için
-#include <WebServer.h>
+#include "http_server.h"
 
-extern WebServer server;
+extern AppWebServer server;
 extern Settings settings;
 
 // Global password policy değişkeni (header'da extern olarak tanımlı)
@@ -0,0 +1,104 @@
+// rate_limiter.cpp - IP başına token bucket
+#include "rate_limiter.h"
+#include "log_system.h"
+
+// Panel 5 sn'de bir birkaç API sorgusu atar; sayfa açılışı birkaç statik dosya ister;
+// toplu arıza aktarımı komut başına bir UART isteği gönderir (hat zaten sıralı).
+const RateClassConfig rateClassConfig[RATE_CLASS_COUNT] = {
+    {"api",    30, 5},
+    {"static", 60, 20},
+    {"uart",   20, 10}
+};
+
+RateLimitStats rateLimitStats = {{0, 0, 0}, {0, 0, 0}, 0, 0};
+
+#define TOKEN_SCALE 1000   // Kovalar mili-istek cinsinden: kesirli dolum için
+
+struct RateClient {
+    uint32_t ip;                          // 0 = boş yuva
+    unsigned long lastSeen;
+    unsigned long lastRefill;
+    int32_t tokens[RATE_CLASS_COUNT];
+    uint8_t throttledMask;                // Reddi loglanmış sınıflar (tekrar loglanmaz)
+};
+
+static RateClient clients[RATE_LIMIT_TABLE_SIZE];
+
+static uint32_t slotFor(uint32_t ip) {
+    return (ip * 2654435761u) >> (32 - RATE_LIMIT_TABLE_BITS);   // Fibonacci özeti
+}
+
+static RateClient& findClient(uint32_t ip, unsigned long now) {
+    uint32_t start = slotFor(ip);
+    RateClient* victim = NULL;
+
+    for (uint32_t i = 0; i < RATE_LIMIT_PROBE; i++) {
+        RateClient& c = clients[(start + i) & (RATE_LIMIT_TABLE_SIZE - 1)];
+        if (c.ip == ip) return c;
+        if (c.ip == 0) {
+            victim = &c;
+            break;
+        }
+        if (victim == NULL || now - c.lastSeen > now - victim->lastSeen) {
+            victim = &c;
+        }
+    }
+
+    if (victim->ip != 0) {
+        rateLimitStats.evicted++;
+    } else {
+        rateLimitStats.tracked++;
+    }
+
+    // Yeni istemci dolu kovalarla başlar
+    victim->ip = ip;
+    victim->lastRefill = now;
+    victim->throttledMask = 0;
+    for (int k = 0; k < RATE_CLASS_COUNT; k++) {
+        victim->tokens[k] = (int32_t)rateClassConfig[k].burst * TOKEN_SCALE;
+    }
+    return *victim;
+}
+
+bool rateLimitAllow(uint32_t ip, RateClass rateClass, uint32_t& retryAfterSec) {
+    unsigned long now = millis();
+    RateClient& client = findClient(ip, now);
+    client.lastSeen = now;
+
+    // Geçen süre kadar tüm kovaları doldur (perSecond istek/sn = perSecond mili-istek/ms)
+    unsigned long elapsed = now - client.lastRefill;
+    if (elapsed > 0) {
+        client.lastRefill = now;
+        for (int k = 0; k < RATE_CLASS_COUNT; k++) {
+            int32_t capacity = (int32_t)rateClassConfig[k].burst * TOKEN_SCALE;
+            int32_t refill = elapsed >= 60000 ? capacity : (int32_t)(elapsed * rateClassConfig[k].perSecond);
+            client.tokens[k] = min(capacity, client.tokens[k] + refill);
+        }
+    }
+
+    int32_t& tokens = client.tokens[rateClass];
+    uint8_t bit = 1 << rateClass;
+    if (tokens >= TOKEN_SCALE) {
+        tokens -= TOKEN_SCALE;
+        client.throttledMask &= ~bit;
+        rateLimitStats.allowed[rateClass]++;
+        return true;
+    }
+
+    rateLimitStats.rejected[rateClass]++;
+    uint32_t perSecondScaled = (uint32_t)rateClassConfig[rateClass].perSecond * TOKEN_SCALE;
+    retryAfterSec = (TOKEN_SCALE - tokens + perSecondScaled - 1) / perSecondScaled;
+    if (retryAfterSec < 1) retryAfterSec = 1;
+
+    // Kısılma başına bir log: sel halinde log halkası ve SSE yayınları dolmaz
+    if ((client.throttledMask & bit) == 0) {
+        client.throttledMask |= bit;
+        addLog("⚠️ Rate limit aşıldı (" + String(rateClassConfig[rateClass].name) + "): " +
+               IPAddress(ip).toString(), WARN, "SECURITY");
+    }
+    return false;
+}
+
+const char* rateClassName(RateClass rateClass) {
+    return rateClass < RATE_CLASS_COUNT ? rateClassConfig[rateClass].name : "unknown";
+}
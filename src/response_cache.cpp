@@ -0,0 +1,122 @@
+// response_cache.cpp - Serileştirilmiş API yanıtı önbelleği
+#include "response_cache.h"
+#include "settings.h"
+#include "http_server.h"
+#include "state_version.h"
+#include <LittleFS.h>
+
+ResponseCacheStats responseCacheStats[RESPONSE_CACHE_ITEMS] = {};
+
+#define NO_STATE_DOMAIN -1
+
+struct ResponseCacheEntry {
+    const unsigned long ttl;
+    const int domain;             // Bağlı durum alanı (StateDomain) ya da NO_STATE_DOMAIN
+    String body;                  // Yalnızca web task'ında okunur/yazılır
+    unsigned long storedAt;
+    uint32_t version;             // Saklandığı andaki durum sürümü
+    volatile bool valid;          // Diğer task'lar yalnızca bunu temizler
+};
+
+static ResponseCacheEntry entries[RESPONSE_CACHE_ITEMS] = {
+    {DEVICE_INFO_RESPONSE_TTL, STATE_NETWORK,   String(), 0, 0, false},
+    {SYSTEM_INFO_RESPONSE_TTL, NO_STATE_DOMAIN, String(), 0, 0, false}
+};
+
+static bool isFresh(ResponseCacheEntry& entry, ResponseCacheStats& stats) {
+    if (!entry.valid) return false;
+
+    if (entry.domain != NO_STATE_DOMAIN && getStateVersion((StateDomain)entry.domain) != entry.version) {
+        entry.valid = false;
+        stats.invalidations++;
+        return false;
+    }
+    return millis() - entry.storedAt < entry.ttl;
+}
+
+bool responseCacheServe(ResponseCacheItem item) {
+    ResponseCacheEntry& entry = entries[item];
+    ResponseCacheStats& stats = responseCacheStats[item];
+
+    if (!isFresh(entry, stats)) {
+        stats.misses++;
+        return false;
+    }
+
+    stats.hits++;
+    server.send(200, "application/json", entry.body);
+    return true;
+}
+
+void responseCacheStore(ResponseCacheItem item, const JsonDocument& doc) {
+    ResponseCacheEntry& entry = entries[item];
+
+    // Sürüm gövdeden önce alınır: üretim sırasında değişirse sonraki istek yeniler
+    if (entry.domain != NO_STATE_DOMAIN) {
+        entry.version = getStateVersion((StateDomain)entry.domain);
+    }
+
+    entry.body = "";
+    entry.body.reserve(measureJson(doc));
+    serializeJson(doc, entry.body);
+    entry.storedAt = millis();
+    entry.valid = true;
+    responseCacheStats[item].bytes = entry.body.length();
+
+    server.send(200, "application/json", entry.body);
+}
+
+static size_t filesystemTotal = 0;
+static size_t filesystemUsed = 0;
+static unsigned long filesystemReadAt = 0;
+static bool filesystemValid = false;
+
+void cachedFilesystemUsage(size_t& total, size_t& used) {
+    if (!filesystemValid || millis() - filesystemReadAt >= FILESYSTEM_USAGE_TTL) {
+        filesystemTotal = LittleFS.totalBytes();
+        filesystemUsed = LittleFS.usedBytes();
+        filesystemReadAt = millis();
+        filesystemValid = true;
+    }
+    total = filesystemTotal;
+    used = filesystemUsed;
+}
+
+void invalidateFilesystemUsage() {
+    filesystemValid = false;
+}
+
+void responseCacheInvalidate(ResponseCacheItem item) {
+    // system-info gövdesi doluluğu içerir; saklı değer de tazelenmeli
+    if (item == RESPONSE_CACHE_SYSTEM_INFO) invalidateFilesystemUsage();
+    if (entries[item].valid) {
+        entries[item].valid = false;
+        responseCacheStats[item].invalidations++;
+    }
+}
+
+void responseCacheInvalidateAll() {
+    for (int i = 0; i < RESPONSE_CACHE_ITEMS; i++) {
+        responseCacheInvalidate((ResponseCacheItem)i);
+    }
+}
+
+bool responseCacheHasValue(ResponseCacheItem item) {
+    return entries[item].valid;
+}
+
+unsigned long responseCacheAge(ResponseCacheItem item) {
+    return entries[item].valid ? millis() - entries[item].storedAt : 0;
+}
+
+unsigned long responseCacheTTL(ResponseCacheItem item) {
+    return entries[item].ttl;
+}
+
+const char* responseCacheItemName(ResponseCacheItem item) {
+    switch (item) {
+        case RESPONSE_CACHE_DEVICE_INFO: return "deviceInfo";
+        case RESPONSE_CACHE_SYSTEM_INFO: return "systemInfo";
+        default:                         return "unknown";
+    }
+}
@@ -0,0 +1,74 @@
+// route_metrics.cpp - Rota başına gecikme ve yanıt sayaçları
+#include "route_metrics.h"
+
+// 1, 2, 5, 10, 25, 50, 100, 250 ms, 1 sn ve üstü
+const uint32_t routeLatencyBoundsUs[ROUTE_LATENCY_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+};
+
+static portMUX_TYPE metricsMux = portMUX_INITIALIZER_UNLOCKED;
+static RouteMetrics* metrics = NULL;
+static size_t slotCount = 0;
+static unsigned long resetAt = 0;
+
+void initRouteMetrics(size_t slots) {
+    RouteMetrics* table = new RouteMetrics[slots]();
+
+    portENTER_CRITICAL(&metricsMux);
+    RouteMetrics* old = metrics;
+    metrics = table;
+    slotCount = slots;
+    resetAt = millis();
+    portEXIT_CRITICAL(&metricsMux);
+
+    delete[] old;
+}
+
+size_t routeMetricsSlots() {
+    return slotCount;
+}
+
+void recordRouteMetrics(size_t slot, int status, size_t bytes, uint32_t writes, uint32_t elapsedUs,
+                        int32_t heapDelta, bool deferred) {
+    int bucket = 0;
+    while (bucket < ROUTE_LATENCY_BUCKETS - 1 && elapsedUs >= routeLatencyBoundsUs[bucket]) {
+        bucket++;
+    }
+
+    portENTER_CRITICAL(&metricsMux);
+    if (slot < slotCount) {
+        RouteMetrics& m = metrics[slot];
+        if (m.requests == 0 || heapDelta < m.minHeapDelta) m.minHeapDelta = heapDelta;
+        if (m.requests == 0 || heapDelta > m.maxHeapDelta) m.maxHeapDelta = heapDelta;
+        m.requests++;
+        if (status >= 100 && status < 600) m.statusClass[status / 100 - 1]++;
+        if (deferred) m.deferred++;
+        m.bytesSent += bytes;
+        m.writes += writes;
+        m.totalUs += elapsedUs;
+        if (elapsedUs > m.maxUs) m.maxUs = elapsedUs;
+        m.histogram[bucket]++;
+    }
+    portEXIT_CRITICAL(&metricsMux);
+}
+
+bool getRouteMetrics(size_t slot, RouteMetrics& out) {
+    portENTER_CRITICAL(&metricsMux);
+    bool found = slot < slotCount;
+    if (found) out = metrics[slot];
+    portEXIT_CRITICAL(&metricsMux);
+    return found;
+}
+
+void resetRouteMetrics() {
+    portENTER_CRITICAL(&metricsMux);
+    if (metrics != NULL) {
+        memset(metrics, 0, slotCount * sizeof(RouteMetrics));
+    }
+    resetAt = millis();
+    portEXIT_CRITICAL(&metricsMux);
+}
+
+unsigned long routeMetricsAge() {
+    return millis() - resetAt;
+}
@@ -0,0 +1,175 @@
+// session_store.cpp - Çoklu oturum tablosu
+#include "session_store.h"
+#include "settings.h"
+#include "crypto_utils.h"
+
+extern Settings settings;
+
+SessionStats sessionStats = {0, 0, 0, 0, 0};
+
+struct SessionEntry {
+    char token[SESSION_TOKEN_LENGTH + 1];
+    uint32_t hash;
+    unsigned long createdAt;
+    unsigned long lastActivity;
+    unsigned long expiresAt;
+    bool active;
+};
+
+static portMUX_TYPE sessionMux = portMUX_INITIALIZER_UNLOCKED;
+static SessionEntry sessions[SESSION_TABLE_SIZE];
+static int8_t sessionIndex[SESSION_INDEX_SLOTS];   // oturum sırası, -1 = boş
+static bool indexReady = false;
+
+static uint32_t tokenHash(const char* token, size_t length) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        h = (h ^ (uint8_t)token[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Uzunluk eşitse tüm baytlar karşılaştırılır: süre eşleşen önek uzunluğunu sızdırmaz
+static bool tokenEquals(const char* stored, const char* candidate, size_t length) {
+    if (length != SESSION_TOKEN_LENGTH) return false;
+    uint8_t diff = 0;
+    for (size_t i = 0; i < SESSION_TOKEN_LENGTH; i++) {
+        diff |= (uint8_t)stored[i] ^ (uint8_t)candidate[i];
+    }
+    return diff == 0;
+}
+
+static bool isExpired(const SessionEntry& s, unsigned long now) {
+    return (long)(now - s.expiresAt) >= 0;
+}
+
+// Kritik bölge içinde çağrılır. Silme seyrek (çıkış, süre dolumu, çıkarma): indeks baştan kurulur.
+static void rebuildIndexLocked() {
+    memset(sessionIndex, -1, sizeof(sessionIndex));
+    for (int i = 0; i < SESSION_TABLE_SIZE; i++) {
+        if (!sessions[i].active) continue;
+        uint32_t slot = sessions[i].hash & (SESSION_INDEX_SLOTS - 1);
+        while (sessionIndex[slot] >= 0) {
+            slot = (slot + 1) & (SESSION_INDEX_SLOTS - 1);
+        }
+        sessionIndex[slot] = i;
+    }
+    indexReady = true;
+}
+
+// Kritik bölge içinde çağrılır
+static int findLocked(const char* token, size_t length, uint32_t hash) {
+    if (!indexReady) rebuildIndexLocked();
+    uint32_t slot = hash & (SESSION_INDEX_SLOTS - 1);
+    while (sessionIndex[slot] >= 0) {
+        SessionEntry& s = sessions[sessionIndex[slot]];
+        if (s.hash == hash && tokenEquals(s.token, token, length)) {
+            return sessionIndex[slot];
+        }
+        slot = (slot + 1) & (SESSION_INDEX_SLOTS - 1);
+    }
+    return -1;
+}
+
+String createSession() {
+    String token = generateRandomToken(SESSION_TOKEN_LENGTH);
+    uint32_t hash = tokenHash(token.c_str(), token.length());
+    unsigned long now = millis();
+
+    portENTER_CRITICAL(&sessionMux);
+    // Boş ya da süresi dolmuş yuva; yoksa en az kullanılan (LRU)
+    int target = -1;
+    bool evicting = false;
+    for (int i = 0; i < SESSION_TABLE_SIZE; i++) {
+        SessionEntry& s = sessions[i];
+        if (!s.active || isExpired(s, now)) {
+            if (s.active) sessionStats.expired++;
+            target = i;
+            evicting = false;
+            break;
+        }
+        if (target < 0 || now - s.lastActivity > now - sessions[target].lastActivity) {
+            target = i;
+            evicting = true;
+        }
+    }
+    if (evicting) sessionStats.evicted++;
+
+    SessionEntry& entry = sessions[target];
+    memcpy(entry.token, token.c_str(), SESSION_TOKEN_LENGTH);
+    entry.token[SESSION_TOKEN_LENGTH] = '\0';
+    entry.hash = hash;
+    entry.createdAt = now;
+    entry.lastActivity = now;
+    entry.expiresAt = now + settings.SESSION_TIMEOUT;
+    entry.active = true;
+    sessionStats.created++;
+    rebuildIndexLocked();
+    portEXIT_CRITICAL(&sessionMux);
+
+    return token;
+}
+
+SessionResult lookupSession(const String& token, bool touch) {
+    if (token.length() != SESSION_TOKEN_LENGTH) {
+        sessionStats.rejected++;
+        return SESSION_UNKNOWN;
+    }
+    uint32_t hash = tokenHash(token.c_str(), token.length());
+    unsigned long now = millis();
+    SessionResult result = SESSION_VALID;
+
+    portENTER_CRITICAL(&sessionMux);
+    int i = findLocked(token.c_str(), token.length(), hash);
+    if (i < 0) {
+        result = SESSION_UNKNOWN;
+    } else if (isExpired(sessions[i], now)) {
+        sessions[i].active = false;
+        sessionStats.expired++;
+        rebuildIndexLocked();
+        result = SESSION_EXPIRED;
+    } else if (touch) {
+        sessions[i].lastActivity = now;
+        sessions[i].expiresAt = now + settings.SESSION_TIMEOUT;
+    }
+    if (result != SESSION_VALID) sessionStats.rejected++;
+    portEXIT_CRITICAL(&sessionMux);
+
+    return result;
+}
+
+bool revokeSession(const String& token) {
+    uint32_t hash = tokenHash(token.c_str(), token.length());
+    portENTER_CRITICAL(&sessionMux);
+    int i = findLocked(token.c_str(), token.length(), hash);
+    if (i >= 0) {
+        sessions[i].active = false;
+        sessionStats.revoked++;
+        rebuildIndexLocked();
+    }
+    portEXIT_CRITICAL(&sessionMux);
+    return i >= 0;
+}
+
+void revokeAllSessions() {
+    portENTER_CRITICAL(&sessionMux);
+    for (int i = 0; i < SESSION_TABLE_SIZE; i++) {
+        if (sessions[i].active) {
+            sessions[i].active = false;
+            sessionStats.revoked++;
+        }
+    }
+    rebuildIndexLocked();
+    portEXIT_CRITICAL(&sessionMux);
+}
+
+int activeSessionCount() {
+    unsigned long now = millis();
+    int count = 0;
+    portENTER_CRITICAL(&sessionMux);
+    for (int i = 0; i < SESSION_TABLE_SIZE; i++) {
+        if (sessions[i].active && !isExpired(sessions[i], now)) count++;
+    }
+    portEXIT_CRITICAL(&sessionMux);
+    return count;
+}
@@ -1,9 +1,11 @@
 #include "settings.h"
 #include "log_system.h"
 #include "crypto_utils.h"
+#include "state_version.h"
+#include "session_store.h"
 #include <Preferences.h>
 
-WebServer server(80);
+AppWebServer server(80);
 Settings settings;
 
 void loadSettings() {
@@ -39,9 +41,7 @@ void loadSettings() {
 
     prefs.end();
 
-    // Oturum başlangıçta geçersiz
-    settings.sessionToken = "";
-    settings.sessionStartTime = 0;
+    // Oturum tablosu başlangıçta boş
     settings.SESSION_TIMEOUT = 3600000; // 60 dakika
 
     addLog("Ayarlar yüklendi", INFO, "SETTINGS");
@@ -79,13 +79,14 @@ bool saveSettings(const String& newDevName, const String& newTmName,
         prefs.putString("p_salt", settings.passwordSalt);
         prefs.putString("p_hash", settings.passwordHash);
         
-        // Şifre değiştiğinde oturumu sonlandır
-        settings.sessionToken = "";
+        // Şifre değiştiğinde tüm oturumları sonlandır
+        revokeAllSessions();
         
-        addLog("Şifre değiştirildi, oturum sonlandırıldı.", INFO, "SETTINGS");
+        addLog("Şifre değiştirildi, oturumlar sonlandırıldı.", INFO, "SETTINGS");
     }
 
     prefs.end();
+    bumpStateVersion(STATE_SETTINGS);
     addLog("Ayarlar kaydedildi", SUCCESS, "SETTINGS");
     return true;
 }
@@ -0,0 +1,41 @@
+// state_version.cpp - Durum alanı sürüm sayaçları (koşullu GET için)
+#include "state_version.h"
+
+StateVersionStats stateVersionStats[STATE_DOMAIN_COUNT] = {};
+
+// addLog() her iki çekirdekten çağrılır - artırım kritik bölgede
+static portMUX_TYPE versionMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t versions[STATE_DOMAIN_COUNT] = {0, 0, 0, 0};
+static uint32_t bootId = 0;
+
+void initStateVersions() {
+    bootId = esp_random();
+}
+
+void bumpStateVersion(StateDomain domain) {
+    portENTER_CRITICAL(&versionMux);
+    versions[domain]++;
+    portEXIT_CRITICAL(&versionMux);
+}
+
+uint32_t getStateVersion(StateDomain domain) {
+    portENTER_CRITICAL(&versionMux);
+    uint32_t version = versions[domain];
+    portEXIT_CRITICAL(&versionMux);
+    return version;
+}
+
+String stateETag(StateDomain domain) {
+    static const char prefixes[STATE_DOMAIN_COUNT] = {'s', 'n', 't', 'l'};
+    return "W/\"" + String(prefixes[domain]) + String(bootId, HEX) + "-" + String(getStateVersion(domain)) + "\"";
+}
+
+const char* stateDomainName(StateDomain domain) {
+    switch (domain) {
+        case STATE_SETTINGS: return "settings";
+        case STATE_NETWORK:  return "network";
+        case STATE_NTP:      return "ntp";
+        case STATE_LOGS:     return "logs";
+        default:             return "unknown";
+    }
+}
@@ -0,0 +1,140 @@
+// static_assets.cpp - Derleme aşamasında üretilen web dosyası manifesti
+#include "static_assets.h"
+#include "log_system.h"
+#include <LittleFS.h>
+#include <ArduinoJson.h>
+
+#if __has_include("web_assets_data.h")
+#include "web_assets_data.h"
+#else
+#define EMBEDDED_ASSET_COUNT 0
+#endif
+
+StaticAssetStats staticAssetStats = {0, 0, 0, 0};
+RangeStats rangeStats = {0, 0, 0, 0};
+
+static StaticAsset assets[STATIC_ASSET_MAX];
+static int assetCount = 0;
+
+void initStaticAssets() {
+    assetCount = 0;
+
+    if (EMBEDDED_ASSET_COUNT > 0) {
+        addLog("✅ Gömülü web dosyaları: " + String(EMBEDDED_ASSET_COUNT) + " dosya (flash)", SUCCESS, "WEB");
+    }
+
+    File file = LittleFS.open(STATIC_MANIFEST_PATH, "r");
+    if (!file) {
+        addLog("⚠️ Web manifesti yok - dosyalar önbellek doğrulayıcısız sunulacak", WARN, "WEB");
+        return;
+    }
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+    if (error) {
+        addLog("❌ Web manifesti okunamadı: " + String(error.c_str()), ERROR, "WEB");
+        return;
+    }
+
+    for (JsonPair entry : doc["assets"].as<JsonObject>()) {
+        if (assetCount >= STATIC_ASSET_MAX) {
+            addLog("⚠️ Web manifesti sınırı aşıldı (" + String(STATIC_ASSET_MAX) + ")", WARN, "WEB");
+            break;
+        }
+        StaticAsset& asset = assets[assetCount++];
+        asset.path = entry.key().c_str();
+        asset.etag = "\"" + entry.value()["etag"].as<String>() + "\"";
+        asset.version = entry.value()["version"].as<String>();
+        asset.size = entry.value()["gzip"] | 0;
+    }
+
+    addLog("✅ Web manifesti yüklendi: " + String(assetCount) + " dosya", SUCCESS, "WEB");
+}
+
+const StaticAsset* findStaticAsset(const String& path) {
+    for (int i = 0; i < assetCount; i++) {
+        if (assets[i].path == path) return &assets[i];
+    }
+    return NULL;
+}
+
+int staticAssetCount() {
+    return assetCount;
+}
+
+const EmbeddedAsset* findEmbeddedAsset(const String& path) {
+#if EMBEDDED_ASSET_COUNT > 0
+    for (int i = 0; i < EMBEDDED_ASSET_COUNT; i++) {
+        if (path == embeddedAssets[i].path) return &embeddedAssets[i];
+    }
+#endif
+    return NULL;
+}
+
+int embeddedAssetCount() {
+    return EMBEDDED_ASSET_COUNT;
+}
+
+bool etagMatches(const String& ifNoneMatch, const String& etag) {
+    if (ifNoneMatch.length() == 0) return false;
+    if (ifNoneMatch == "*") return true;
+
+    String opaque = etag.startsWith("W/") ? etag.substring(2) : etag;
+
+    int start = 0;
+    while (start < (int)ifNoneMatch.length()) {
+        int comma = ifNoneMatch.indexOf(',', start);
+        if (comma < 0) comma = ifNoneMatch.length();
+        String candidate = ifNoneMatch.substring(start, comma);
+        candidate.trim();
+        // Zayıf karşılaştırma: W/"x" ile "x" eşleşir (If-None-Match için RFC 9110)
+        if (candidate.startsWith("W/")) candidate = candidate.substring(2);
+        if (candidate == opaque) return true;
+        start = comma + 1;
+    }
+    return false;
+}
+
+static bool isDigits(const String& value) {
+    for (unsigned int i = 0; i < value.length(); i++) {
+        if (!isdigit((unsigned char)value[i])) return false;
+    }
+    return true;
+}
+
+RangeResult parseByteRange(const String& header, size_t total, size_t& start, size_t& length) {
+    if (!header.startsWith("bytes=")) return RANGE_NONE;
+    String spec = header.substring(6);
+    spec.trim();
+    if (spec.indexOf(',') >= 0) return RANGE_NONE;
+
+    int dash = spec.indexOf('-');
+    if (dash < 0) return RANGE_NONE;
+    String first = spec.substring(0, dash);
+    String last = spec.substring(dash + 1);
+    first.trim();
+    last.trim();
+    if (!isDigits(first) || !isDigits(last) || (first.length() == 0 && last.length() == 0)) {
+        return RANGE_NONE;
+    }
+
+    if (first.length() == 0) {
+        // Son n bayt: büyüyen kayıtların kuyruğu
+        size_t n = strtoul(last.c_str(), NULL, 10);
+        if (n == 0 || total == 0) return RANGE_UNSATISFIABLE;
+        if (n > total) n = total;
+        start = total - n;
+        length = n;
+        return RANGE_SATISFIABLE;
+    }
+
+    size_t from = strtoul(first.c_str(), NULL, 10);
+    if (from >= total) return RANGE_UNSATISFIABLE;
+    size_t to = last.length() > 0 ? strtoul(last.c_str(), NULL, 10) : total - 1;
+    if (to < from) return RANGE_NONE;
+    if (to >= total) to = total - 1;
+    start = from;
+    length = to - from + 1;
+    return RANGE_SATISFIABLE;
+}
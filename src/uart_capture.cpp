@@ -0,0 +1,219 @@
+// uart_capture.cpp - UART çerçeve kaydı (halka tampon)
+#include "uart_capture.h"
+#include "log_system.h"
+
+volatile bool uartCaptureEnabled = false;
+UARTCaptureStats uartCaptureStats = {false, 0, 0, 0, 0, 0, 0, 0, 0};
+
+// TX webServerTask'tan da uartTask'tan da gelebilir
+static portMUX_TYPE captureMux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t* ring = NULL;
+static uint32_t ringHead = 0;     // Sonraki yazma konumu
+static uint32_t ringTail = 0;     // En eski kaydın başı
+static uint16_t nextSequence = 0;
+static uint32_t clearCount = 0;   // Temizlemeden sonra aynı sayaçlar farklı içerik demektir
+static uint32_t pauseCount = 0;   // Süren indirme sayısı; sıfırdan büyükse halka yazılmaz
+
+// Kritik bölge içinde çağrılır
+static void ringWrite(const void* src, uint32_t length) {
+    const uint8_t* bytes = (const uint8_t*)src;
+    uint32_t capacity = uartCaptureStats.capacity;
+    uint32_t first = capacity - ringHead;
+    if (first > length) first = length;
+
+    memcpy(ring + ringHead, bytes, first);
+    if (length > first) {
+        memcpy(ring, bytes + first, length - first);
+    }
+    ringHead = (ringHead + length) % capacity;
+}
+
+static void ringRead(uint32_t position, void* dst, uint32_t length) {
+    uint8_t* bytes = (uint8_t*)dst;
+    uint32_t capacity = uartCaptureStats.capacity;
+    uint32_t first = capacity - position;
+    if (first > length) first = length;
+
+    memcpy(bytes, ring + position, first);
+    if (length > first) {
+        memcpy(bytes + first, ring, length - first);
+    }
+}
+
+// En eski kaydı at
+static void evictOldest() {
+    CaptureRecordHeader header;
+    ringRead(ringTail, &header, sizeof(header));
+    uint32_t size = sizeof(header) + header.length;
+
+    ringTail = (ringTail + size) % uartCaptureStats.capacity;
+    uartCaptureStats.usedBytes -= size;
+    uartCaptureStats.records--;
+    uartCaptureStats.dropped++;
+}
+
+void uartCaptureRecord(uint8_t flags, const char* data, size_t length) {
+    uint32_t startCycles = ESP.getCycleCount();
+    uint32_t timestamp = micros();
+
+    if (length > CAPTURE_MAX_PAYLOAD) {
+        length = CAPTURE_MAX_PAYLOAD;
+        flags |= CAPTURE_FLAG_TRUNCATED;
+    }
+
+    CaptureRecordHeader header;
+    header.timestampUs = timestamp;
+    header.flags = flags;
+    header.length = (uint8_t)length;
+    uint32_t size = sizeof(header) + length;
+
+    portENTER_CRITICAL(&captureMux);
+    if (ring == NULL || !uartCaptureEnabled || pauseCount > 0) {
+        portEXIT_CRITICAL(&captureMux);
+        return;
+    }
+
+    while (uartCaptureStats.capacity - uartCaptureStats.usedBytes < size) {
+        evictOldest();
+    }
+
+    header.sequence = nextSequence++;
+    ringWrite(&header, sizeof(header));
+    if (length > 0) {
+        ringWrite(data, length);
+    }
+    uartCaptureStats.usedBytes += size;
+    uartCaptureStats.records++;
+    if (flags & CAPTURE_FLAG_TRUNCATED) {
+        uartCaptureStats.truncated++;
+    }
+
+    uint32_t cycles = ESP.getCycleCount() - startCycles;
+    uartCaptureStats.recordCalls++;
+    uartCaptureStats.totalCycles += cycles;
+    if (cycles > uartCaptureStats.maxCycles) {
+        uartCaptureStats.maxCycles = cycles;
+    }
+    portEXIT_CRITICAL(&captureMux);
+}
+
+bool startUARTCapture() {
+    if (ring == NULL) {
+        // Tampon ilk kullanımda bir kez ayrılır ve serbest bırakılmaz
+        if (psramFound()) {
+            ring = (uint8_t*)ps_malloc(CAPTURE_RING_SIZE_PSRAM);
+            if (ring != NULL) {
+                uartCaptureStats.capacity = CAPTURE_RING_SIZE_PSRAM;
+                uartCaptureStats.inPsram = true;
+            }
+        }
+        if (ring == NULL) {
+            ring = (uint8_t*)malloc(CAPTURE_RING_SIZE_HEAP);
+            if (ring == NULL) {
+                addLog("❌ UART kayıt tamponu ayrılamadı", ERROR, "CAPTURE");
+                return false;
+            }
+            uartCaptureStats.capacity = CAPTURE_RING_SIZE_HEAP;
+            uartCaptureStats.inPsram = false;
+        }
+    }
+
+    uartCaptureEnabled = true;
+    addLog("🎙️ UART kaydı başladı (" + String(uartCaptureStats.capacity / 1024) + " KB, " +
+           (uartCaptureStats.inPsram ? "PSRAM" : "heap") + ")", INFO, "CAPTURE");
+    return true;
+}
+
+void stopUARTCapture() {
+    if (!uartCaptureEnabled) return;
+    uartCaptureEnabled = false;
+    addLog("⏹️ UART kaydı durdu: " + String(uartCaptureStats.records) + " kayıt", INFO, "CAPTURE");
+}
+
+void clearUARTCapture() {
+    portENTER_CRITICAL(&captureMux);
+    ringHead = 0;
+    ringTail = 0;
+    nextSequence = 0;
+    clearCount++;
+    uartCaptureStats.usedBytes = 0;
+    uartCaptureStats.records = 0;
+    uartCaptureStats.dropped = 0;
+    uartCaptureStats.truncated = 0;
+    uartCaptureStats.recordCalls = 0;
+    uartCaptureStats.totalCycles = 0;
+    uartCaptureStats.maxCycles = 0;
+    portEXIT_CRITICAL(&captureMux);
+}
+
+void uartCapturePause() {
+    portENTER_CRITICAL(&captureMux);
+    pauseCount++;
+    portEXIT_CRITICAL(&captureMux);
+}
+
+void uartCaptureResume() {
+    portENTER_CRITICAL(&captureMux);
+    if (pauseCount > 0) pauseCount--;
+    portEXIT_CRITICAL(&captureMux);
+}
+
+size_t uartCaptureExportSize() {
+    return sizeof(CaptureFileHeader) + uartCaptureStats.usedBytes;
+}
+
+String uartCaptureExportTag() {
+    portENTER_CRITICAL(&captureMux);
+    uint32_t clears = clearCount;
+    uint32_t records = uartCaptureStats.records;
+    uint32_t dropped = uartCaptureStats.dropped;
+    portEXIT_CRITICAL(&captureMux);
+    return "\"cap-" + String(clears, HEX) + "-" + String(dropped, HEX) + "-" + String(records, HEX) + "\"";
+}
+
+// Dosyayı parça parça okur: önce başlık, sonra kuyruktan başlayarak kayıtlar
+size_t uartCaptureExportRead(size_t offset, uint8_t* buffer, size_t length) {
+    size_t total = uartCaptureExportSize();
+    if (offset >= total) return 0;
+    if (length > total - offset) length = total - offset;
+
+    size_t written = 0;
+    if (offset < sizeof(CaptureFileHeader)) {
+        CaptureFileHeader header;
+        memcpy(header.magic, CAPTURE_FILE_MAGIC, 4);
+        header.version = CAPTURE_FILE_VERSION;
+        header.reserved = 0;
+        header.headerSize = sizeof(CaptureFileHeader);
+        header.recordCount = uartCaptureStats.records;
+        header.droppedRecords = uartCaptureStats.dropped;
+
+        size_t n = sizeof(header) - offset;
+        if (n > length) n = length;
+        memcpy(buffer, (const uint8_t*)&header + offset, n);
+        written = n;
+        offset += n;
+    }
+
+    if (written < length && ring != NULL) {
+        uint32_t position = (ringTail + (offset - sizeof(CaptureFileHeader))) % uartCaptureStats.capacity;
+        portENTER_CRITICAL(&captureMux);
+        ringRead(position, buffer + written, length - written);
+        portEXIT_CRITICAL(&captureMux);
+        written = length;
+    }
+    return written;
+}
+
+static uint32_t cyclesToNs(uint64_t cycles) {
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    return mhz > 0 ? (uint32_t)(cycles * 1000 / mhz) : 0;
+}
+
+uint32_t uartCaptureAvgOverheadNs() {
+    if (uartCaptureStats.recordCalls == 0) return 0;
+    return cyclesToNs(uartCaptureStats.totalCycles / uartCaptureStats.recordCalls);
+}
+
+uint32_t uartCaptureMaxOverheadNs() {
+    return cyclesToNs(uartCaptureStats.maxCycles);
+}
@@ -0,0 +1,408 @@
+// uart_console.cpp - /api/uart/console (WebSocket UART konsolu)
+#include "uart_console.h"
+#include "uart_capture.h"
+#include "uart_handler.h"
+#include "uart_scheduler.h"
+#include "http_server.h"
+#include "auth_system.h"
+#include "settings.h"
+#include "log_system.h"
+#include <ArduinoJson.h>
+#include "mbedtls/sha1.h"
+#include "mbedtls/base64.h"
+
+extern AppWebServer server;
+extern Settings settings;
+
+#define WS_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+#define WS_OP_TEXT   0x1
+#define WS_OP_BINARY 0x2
+#define WS_OP_CLOSE  0x8
+#define WS_OP_PING   0x9
+#define WS_OP_PONG   0xA
+
+#define WS_CLOSE_NORMAL      1000
+#define WS_CLOSE_GOING_AWAY  1001
+#define WS_CLOSE_PROTOCOL    1002
+#define WS_CLOSE_UNSUPPORTED 1003
+#define WS_CLOSE_POLICY      1008
+#define WS_CLOSE_TOO_BIG     1009
+
+#define WS_READ_TIMEOUT      1000   // ms - başlamış bir çerçevenin kalanı için
+#define FORWARD_WAIT_MS      10     // Konsol turu: çerçeve yoksa bu kadar bekle
+#define FORWARD_MAX_PER_TICK 16
+
+static UARTConsoleStats uartConsoleStats = {0, 0, 0, 0, 0, 0, 0, false};
+static portMUX_TYPE consoleStatsMux = portMUX_INITIALIZER_UNLOCKED;
+volatile bool uartMirrorEnabled = false;
+
+// Sayaçları UART sıcak yolu, konsol task'ı ve web task'ı ayrı çekirdeklerden yazar
+static void countConsole(unsigned long& counter) {
+    portENTER_CRITICAL(&consoleStatsMux);
+    counter++;
+    portEXIT_CRITICAL(&consoleStatsMux);
+}
+
+static void setConsoleActive(bool active, unsigned long& counter) {
+    portENTER_CRITICAL(&consoleStatsMux);
+    uartConsoleStats.active = active;
+    counter++;
+    portEXIT_CRITICAL(&consoleStatsMux);
+}
+
+void getUARTConsoleStats(UARTConsoleStats& out) {
+    portENTER_CRITICAL(&consoleStatsMux);
+    out = uartConsoleStats;
+    portEXIT_CRITICAL(&consoleStatsMux);
+}
+
+struct ConsoleSession {
+    WiFiClient client;
+    String token;
+};
+
+// uartMirrorFrame'den konsol task'ına sabit boyutlu kayıt
+struct ConsoleFrame {
+    uint32_t timestampUs;
+    uint8_t flags;
+    uint8_t length;
+    char data[UART_CONSOLE_FRAME_MAX + 1];
+};
+
+static QueueHandle_t handoffQueue = NULL;   // webServerTask -> konsol task'ı (ConsoleSession*)
+static QueueHandle_t mirrorQueue = NULL;    // UART sıcak yolu -> konsol task'ı (ConsoleFrame)
+static TaskHandle_t consoleTaskHandle = NULL;
+
+// Sıcak yol: kopyala ve bekleme yapmadan kuyruğa bırak
+void uartMirrorFrame(uint8_t flags, const char* data, size_t length) {
+    if (mirrorQueue == NULL) return;
+
+    ConsoleFrame frame;
+    frame.timestampUs = micros();
+    if (length > UART_CONSOLE_FRAME_MAX) {
+        length = UART_CONSOLE_FRAME_MAX;
+        flags |= CAPTURE_FLAG_TRUNCATED;
+    }
+    frame.flags = flags;
+    frame.length = (uint8_t)length;
+    memcpy(frame.data, data, length);
+    frame.data[length] = '\0';
+
+    if (xQueueSend(mirrorQueue, &frame, 0) != pdTRUE) {
+        countConsole(uartConsoleStats.framesDropped);
+    }
+}
+
+static String websocketAccept(const String& key) {
+    String source = key + WS_GUID;
+    unsigned char digest[20];
+
+    mbedtls_sha1_context ctx;
+    mbedtls_sha1_init(&ctx);
+    mbedtls_sha1_starts(&ctx);
+    mbedtls_sha1_update(&ctx, (const unsigned char*) source.c_str(), source.length());
+    mbedtls_sha1_finish(&ctx, digest);
+    mbedtls_sha1_free(&ctx);
+
+    unsigned char encoded[32];
+    size_t written = 0;
+    mbedtls_base64_encode(encoded, sizeof(encoded), &written, digest, sizeof(digest));
+    return String((const char*) encoded);
+}
+
+// Sunucu çerçeveleri maskesiz gider; yükler 64 KB altında
+static bool sendFrame(WiFiClient& client, uint8_t opcode, const uint8_t* payload, size_t length) {
+    uint8_t head[4];
+    size_t headLength = 2;
+    head[0] = 0x80 | opcode;
+    if (length < 126) {
+        head[1] = (uint8_t)length;
+    } else {
+        head[1] = 126;
+        head[2] = (uint8_t)(length >> 8);
+        head[3] = (uint8_t)length;
+        headLength = 4;
+    }
+    if (client.write(head, headLength) != headLength) return false;
+    return length == 0 || client.write(payload, length) == length;
+}
+
+static bool sendText(WiFiClient& client, const String& text) {
+    return sendFrame(client, WS_OP_TEXT, (const uint8_t*) text.c_str(), text.length());
+}
+
+static void sendClose(WiFiClient& client, uint16_t code) {
+    uint8_t payload[2] = {(uint8_t)(code >> 8), (uint8_t)code};
+    sendFrame(client, WS_OP_CLOSE, payload, sizeof(payload));
+}
+
+static bool readExact(WiFiClient& client, uint8_t* buffer, size_t length) {
+    unsigned long start = millis();
+    size_t received = 0;
+    while (received < length) {
+        int n = client.read(buffer + received, length - received);
+        if (n > 0) {
+            received += n;
+            continue;
+        }
+        if (!client.connected() || millis() - start >= WS_READ_TIMEOUT) return false;
+        vTaskDelay(1);
+    }
+    return true;
+}
+
+static bool isConsoleClientAlive(void* context) {
+    return static_cast<WiFiClient*>(context)->connected();
+}
+
+static void closeSession(ConsoleSession*& session, unsigned long& reason) {
+    uartMirrorEnabled = false;
+    xQueueReset(mirrorQueue);
+    session->client.stop();
+    delete session;
+    session = NULL;
+    setConsoleActive(false, reason);
+}
+
+// Tarayıcı geçersiz UTF-8 taşıyan metin çerçevesini 1007 ile kapatır. Yazdırılabilir ASCII
+// aynen, ters bölü \\, kalan baytlar (kontrol, >= 0x80, NUL) \xHH olarak gider.
+static String escapeFrameData(const char* data, size_t length) {
+    static const char hex[] = "0123456789ABCDEF";
+    String text;
+    text.reserve(length + 8);
+    for (size_t i = 0; i < length; i++) {
+        uint8_t c = (uint8_t)data[i];
+        if (c == '\\') {
+            text += "\\\\";
+        } else if (c >= 0x20 && c < 0x7F) {
+            text += (char)c;
+        } else {
+            text += "\\x";
+            text += hex[c >> 4];
+            text += hex[c & 0x0F];
+        }
+    }
+    return text;
+}
+
+// Biriken TX/RX çerçevelerini gönder. wait: kuyruk boşsa ilk çerçeve için bekleme (tick).
+static void forwardFrames(ConsoleSession& session, TickType_t wait) {
+    ConsoleFrame frame;
+    for (int i = 0; i < FORWARD_MAX_PER_TICK; i++) {
+        if (xQueueReceive(mirrorQueue, &frame, i == 0 ? wait : 0) != pdTRUE) return;
+
+        JsonDocument doc;
+        doc["type"] = (frame.flags & CAPTURE_FLAG_RX) ? "rx" : "tx";
+        doc["t"] = frame.timestampUs;
+        doc["data"] = escapeFrameData(frame.data, frame.length);
+        doc["timeout"] = (frame.flags & CAPTURE_FLAG_TIMEOUT) != 0;
+        doc["truncated"] = (frame.flags & CAPTURE_FLAG_TRUNCATED) != 0;
+
+        String text;
+        serializeJson(doc, text);
+        if (!sendText(session.client, text)) return;
+        countConsole(uartConsoleStats.framesSent);
+    }
+}
+
+static bool sessionAuthorized(ConsoleSession& session) {
+    if (isTokenValid(session.token)) return true;
+    sendText(session.client, "{\"type\":\"auth\"}");
+    sendClose(session.client, WS_CLOSE_POLICY);
+    return false;
+}
+
+static bool runCommand(ConsoleSession& session, String command) {
+    command.trim();
+    if (command.length() == 0) return true;
+    if (!sessionAuthorized(session)) return false;
+
+    // Konsol kullanımı da kullanıcı etkinliğidir: oturum süresini yenile
+    touchSession(session.token);
+    countConsole(uartConsoleStats.commands);
+    addLog("🖥️ Konsol komutu: " + command, INFO, "UART");
+
+    UARTCancelToken cancel;
+    cancel.isAlive = isConsoleClientAlive;
+    cancel.context = &session.client;
+    cancel.deadline = 0;
+    cancel.cancelled = false;
+    cancel.expired = false;
+
+    String response;
+    unsigned long start = millis();
+    bool success = sendCustomCommand(command, response, UART_CONSOLE_COMMAND_TIMEOUT,
+                                     UART_PRIO_INTERACTIVE, &cancel);
+    if (cancel.cancelled) return false;
+
+    // Önce hattaki TX/RX, sonra sonuç
+    forwardFrames(session, 0);
+
+    JsonDocument doc;
+    doc["type"] = "result";
+    doc["command"] = command;
+    doc["success"] = success;
+    doc["response"] = response;
+    doc["ms"] = millis() - start;
+
+    String text;
+    serializeJson(doc, text);
+    return sendText(session.client, text);
+}
+
+// İstemciden bir çerçeve oku ve işle. false: bağlantı kapatılmalı.
+static bool readMessage(ConsoleSession& session) {
+    WiFiClient& client = session.client;
+    uint8_t head[2];
+    if (!readExact(client, head, sizeof(head))) return false;
+
+    bool fin = (head[0] & 0x80) != 0;
+    uint8_t opcode = head[0] & 0x0F;
+    bool masked = (head[1] & 0x80) != 0;
+    size_t length = head[1] & 0x7F;
+
+    if (length == 126) {
+        uint8_t ext[2];
+        if (!readExact(client, ext, sizeof(ext))) return false;
+        length = ((size_t)ext[0] << 8) | ext[1];
+    } else if (length == 127) {
+        sendClose(client, WS_CLOSE_TOO_BIG);
+        return false;
+    }
+
+    // İstemci çerçeveleri maskeli olmak zorunda (RFC 6455 5.1)
+    if (!masked) {
+        sendClose(client, WS_CLOSE_PROTOCOL);
+        return false;
+    }
+    if (length > UART_CONSOLE_MAX_MESSAGE) {
+        sendClose(client, WS_CLOSE_TOO_BIG);
+        return false;
+    }
+
+    uint8_t mask[4];
+    uint8_t payload[UART_CONSOLE_MAX_MESSAGE + 1];
+    if (!readExact(client, mask, sizeof(mask))) return false;
+    if (length > 0 && !readExact(client, payload, length)) return false;
+    for (size_t i = 0; i < length; i++) {
+        payload[i] ^= mask[i & 3];
+    }
+    payload[length] = '\0';
+
+    // Komutlar kısa: parçalı mesaj desteklenmez
+    if (!fin || opcode == 0) {
+        sendClose(client, WS_CLOSE_UNSUPPORTED);
+        return false;
+    }
+
+    switch (opcode) {
+        case WS_OP_TEXT:
+            return runCommand(session, String((const char*) payload));
+        case WS_OP_PING:
+            return sendFrame(client, WS_OP_PONG, payload, length);
+        case WS_OP_PONG:
+            return true;
+        case WS_OP_CLOSE:
+            sendClose(client, WS_CLOSE_NORMAL);
+            return false;
+        case WS_OP_BINARY:
+            sendClose(client, WS_CLOSE_UNSUPPORTED);
+            return false;
+        default:
+            sendClose(client, WS_CLOSE_PROTOCOL);
+            return false;
+    }
+}
+
+// Soket G/Ç'sinin tamamı bu task'ta: komut dsPIC'i beklerken web sunucusu çalışmaya devam eder
+static void consoleTask(void* parameter) {
+    ConsoleSession* session = NULL;
+    unsigned long lastAuthCheck = 0;
+
+    while (true) {
+        ConsoleSession* incoming = NULL;
+        if (xQueueReceive(handoffQueue, &incoming, session == NULL ? portMAX_DELAY : 0) == pdTRUE) {
+            // Tek konsol: yeni bağlantı eskisini kapatır (sekme yenileme eski soketi bırakır)
+            if (session != NULL) {
+                sendClose(session->client, WS_CLOSE_GOING_AWAY);
+                closeSession(session, uartConsoleStats.evicted);
+            }
+            session = incoming;
+            lastAuthCheck = millis();
+            xQueueReset(mirrorQueue);
+            uartMirrorEnabled = true;
+            setConsoleActive(true, uartConsoleStats.connects);
+            addLog("🖥️ UART konsolu bağlandı: " + session->client.remoteIP().toString(), INFO, "UART");
+        }
+        if (session == NULL) continue;
+
+        forwardFrames(*session, pdMS_TO_TICKS(FORWARD_WAIT_MS));
+
+        if (!session->client.connected()) {
+            closeSession(session, uartConsoleStats.disconnects);
+            continue;
+        }
+
+        if (session->client.available() > 0 && !readMessage(*session)) {
+            closeSession(session, uartConsoleStats.disconnects);
+            continue;
+        }
+
+        // Periyodik oturum kontrolü; ping ölü soketin fark edilmesini sağlar
+        if (millis() - lastAuthCheck >= UART_CONSOLE_AUTH_INTERVAL) {
+            lastAuthCheck = millis();
+            if (!sessionAuthorized(*session) || !sendFrame(session->client, WS_OP_PING, NULL, 0)) {
+                closeSession(session, uartConsoleStats.disconnects);
+            }
+        }
+    }
+}
+
+void initUARTConsole() {
+    handoffQueue = xQueueCreate(2, sizeof(ConsoleSession*));
+    mirrorQueue = xQueueCreate(UART_CONSOLE_QUEUE_DEPTH, sizeof(ConsoleFrame));
+    if (handoffQueue == NULL || mirrorQueue == NULL) {
+        addLog("❌ UART konsolu kuyrukları oluşturulamadı", ERROR, "UART");
+        return;
+    }
+    xTaskCreatePinnedToCore(consoleTask, "UARTConsole", UART_CONSOLE_TASK_STACK, NULL, 2,
+                            &consoleTaskHandle, 0);
+}
+
+void handleUARTConsole() {
+    String token = server.arg("token");
+    if (!isTokenValid(token)) {
+        countConsole(uartConsoleStats.rejected);
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+
+    String key = server.header("Sec-WebSocket-Key");
+    if (!server.header("Upgrade").equalsIgnoreCase("websocket") || key.length() == 0 ||
+        server.header("Sec-WebSocket-Version") != "13") {
+        countConsole(uartConsoleStats.rejected);
+        server.sendHeader("Sec-WebSocket-Version", "13");
+        server.send(400, "application/json", "{\"error\":\"WebSocket upgrade required\"}");
+        return;
+    }
+
+    if (handoffQueue == NULL || uxQueueSpacesAvailable(handoffQueue) == 0) {
+        server.send(503, "application/json", "{\"error\":\"Console busy\"}");
+        return;
+    }
+
+    ConsoleSession* session = new ConsoleSession();
+    session->token = token;
+    session->client = server.detachClient();
+    session->client.setNoDelay(true);
+
+    String head = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                  "Sec-WebSocket-Accept: " + websocketAccept(key) + "\r\n\r\n";
+    if (session->client.write((const uint8_t*) head.c_str(), head.length()) != head.length() ||
+        xQueueSend(handoffQueue, &session, 0) != pdTRUE) {
+        session->client.stop();
+        delete session;
+        countConsole(uartConsoleStats.rejected);
+    }
+}
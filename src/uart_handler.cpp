@@ -1,4 +1,6 @@
 #include "uart_handler.h"
+#include "uart_pacer.h"
+#include "uart_capture.h"
 #include "log_system.h"
 #include "settings.h"
 #include <Preferences.h>
@@ -16,16 +18,132 @@ static int uartErrorCount = 0;
 bool uartHealthy = true;
 String lastResponse = "";
 UARTStatistics uartStats = {0, 0, 0, 0, 0, 100.0};
+UARTLinkCounters uartLinkTotals = {0, 0, 0, 0, 0, 0, 0, 0};
+UARTResetStats uartResetStats = {0, 0, 0};
 
-// Buffer temizleme
+// Hata geri çağrısı HardwareSerial olay task'ında çalışır
+static portMUX_TYPE linkMux = portMUX_INITIALIZER_UNLOCKED;
+static UARTLinkWindow linkCurrent = {0, 0, {0, 0, 0, 0, 0, 0, 0, 0}};
+static UARTLinkWindow linkHistory[UART_LINK_WINDOW_HISTORY];
+static int linkHistoryCount = 0;
+static int linkHistoryIndex = 0;
+
+static void countDriverError(UARTLinkCounters& counters, hardwareSerial_error_t error) {
+    switch (error) {
+        case UART_FRAME_ERROR:       counters.frameErrors++;   break;
+        case UART_PARITY_ERROR:      counters.parityErrors++;  break;
+        case UART_FIFO_OVF_ERROR:    counters.fifoOverflows++; break;
+        case UART_BUFFER_FULL_ERROR: counters.bufferFull++;    break;
+        case UART_BREAK_ERROR:       counters.breaks++;        break;
+        default: break;
+    }
+}
+
+static void onUARTDriverError(hardwareSerial_error_t error) {
+    portENTER_CRITICAL(&linkMux);
+    countDriverError(linkCurrent.counters, error);
+    countDriverError(uartLinkTotals, error);
+    portEXIT_CRITICAL(&linkMux);
+}
+
+// end() geri çağrıları siler - her begin() sonrası yeniden bağlanmalı
+static void attachUARTDiagnostics() {
+    UART_PORT.onReceiveError(onUARTDriverError);
+}
+
+static void countRxByte() {
+    linkCurrent.counters.rxBytes++;
+    uartLinkTotals.rxBytes++;
+}
+
+// uartTask'tan saniyede bir çağrılır
+void rollUARTLinkWindow() {
+    unsigned long now = millis();
+    if (linkCurrent.startedAt == 0) {
+        linkCurrent.startedAt = now;
+        return;
+    }
+    if (now - linkCurrent.startedAt < UART_LINK_WINDOW_MS) {
+        return;
+    }
+    
+    portENTER_CRITICAL(&linkMux);
+    linkCurrent.durationMs = now - linkCurrent.startedAt;
+    linkHistory[linkHistoryIndex] = linkCurrent;
+    linkHistoryIndex = (linkHistoryIndex + 1) % UART_LINK_WINDOW_HISTORY;
+    if (linkHistoryCount < UART_LINK_WINDOW_HISTORY) linkHistoryCount++;
+    
+    memset(&linkCurrent.counters, 0, sizeof(linkCurrent.counters));
+    linkCurrent.startedAt = now;
+    linkCurrent.durationMs = 0;
+    portEXIT_CRITICAL(&linkMux);
+}
+
+int getUARTLinkWindows(UARTLinkWindow* out, int maxCount) {
+    if (maxCount <= 0) return 0;
+    
+    portENTER_CRITICAL(&linkMux);
+    out[0] = linkCurrent;
+    out[0].durationMs = millis() - linkCurrent.startedAt;
+    int count = 1;
+    for (int i = 0; i < linkHistoryCount && count < maxCount; i++) {
+        int idx = (linkHistoryIndex - 1 - i + UART_LINK_WINDOW_HISTORY) % UART_LINK_WINDOW_HISTORY;
+        out[count++] = linkHistory[idx];
+    }
+    portEXIT_CRITICAL(&linkMux);
+    return count;
+}
+
+// Süren ve son tamamlanan pencereye (~1-2 dakika) bakar
+const char* getUARTLinkDiagnosis() {
+    UARTLinkWindow windows[2];
+    int count = getUARTLinkWindows(windows, 2);
+    
+    uint32_t lineErrors = 0, overruns = 0, timeouts = 0;
+    for (int i = 0; i < count; i++) {
+        const UARTLinkCounters& c = windows[i].counters;
+        lineErrors += c.frameErrors + c.parityErrors + c.breaks;
+        overruns += c.fifoOverflows + c.bufferFull;
+        timeouts += c.timeouts;
+    }
+    
+    if (lineErrors > 0) return "noise";
+    if (overruns > 0) return "overrun";
+    if (timeouts > 0) return "dspic-slow";
+    return "ok";
+}
+
+// Reset fırtınasını önle: UART_RESET_MIN_INTERVAL içinde ikinci reset yapılmaz
+static bool uartResetAllowed() {
+    if (uartResetStats.lastResetAt != 0 &&
+        millis() - uartResetStats.lastResetAt < UART_RESET_MIN_INTERVAL) {
+        uartResetStats.suppressed++;
+        return false;
+    }
+    return true;
+}
+
+// Buffer temizleme - önce önceki yanıttan bu yana uyarlamalı boşluğu bekle
 void clearUARTBuffer() {
-    delay(50);
+    uartPaceWait();
     while (UART_PORT.available()) {
         UART_PORT.read();
+        countRxByte();
         delay(1);
     }
 }
 
+// Komut çerçevesini gönder
+void sendUARTFrame(const String& frame) {
+    UART_PORT.print(frame);
+    UART_PORT.flush();
+    uartStats.totalFramesSent++;
+    linkCurrent.counters.txBytes += frame.length();
+    uartLinkTotals.txBytes += frame.length();
+    uartPacerFrameSent();
+    uartCaptureFrame(0, frame.c_str(), frame.length());
+}
+
 // UART istatistiklerini güncelle
 void updateUARTStats(bool success) {
     if (success) {
@@ -56,9 +174,13 @@ void resetUART() {
     digitalWrite(UART_TX_PIN, HIGH);
     
     UART_PORT.begin(250000, SERIAL_8N1, UART_RX_PIN, UART_TX_PIN);
+    attachUARTDiagnostics();
     delay(200);
     
     clearUARTBuffer();
+    resetUARTPacer();
+    uartResetStats.resets++;
+    uartResetStats.lastResetAt = millis();
     
     lastUARTActivity = millis();
     uartErrorCount = 0;
@@ -76,6 +198,7 @@ void initUART() {
     pinMode(UART_TX_PIN, OUTPUT);
     
     UART_PORT.begin(250000, SERIAL_8N1, UART_RX_PIN, UART_TX_PIN);
+    attachUARTDiagnostics();
     
     delay(100);
     clearUARTBuffer();
@@ -95,10 +218,17 @@ void initUART() {
 bool testUARTConnection() {
     addLog("🧪 UART bağlantısı test ediliyor...", INFO, "UART");
     
+    // Test arka plan işi - kullanıcı komutu varsa beklemeden vazgeç
+    if (!uartAcquire(UART_PRIO_BACKGROUND, 100)) {
+        addLog("UART hattı meşgul, test ertelendi", DEBUG, "UART");
+        return uartHealthy;
+    }
+    
     if (UART_PORT.available()) {
         String response = "";
         while (UART_PORT.available() && response.length() < 50) {
             char c = UART_PORT.read();
+            countRxByte();
             if (c >= 32 && c <= 126) {
                 response += c;
             }
@@ -108,11 +238,15 @@ bool testUARTConnection() {
             addLog("✅ UART'da mevcut veri: '" + response + "'", SUCCESS, "UART");
             uartHealthy = true;
             lastUARTActivity = millis();
+            uartRelease();
             return true;
         }
     }
     
-    if (UART_PORT) {
+    bool portOpen = UART_PORT;
+    uartRelease();
+    
+    if (portOpen) {
         addLog("✅ UART portu aktif", SUCCESS, "UART");
         uartHealthy = true;
         return true;
@@ -123,6 +257,18 @@ bool testUARTConnection() {
     }
 }
 
+// Okunan çerçeveyi hız denetleyicisine ve trafik kaydına bildir
+static void onFrameReceived(const String& response) {
+    bool received = response.length() > 0;
+    uartPacerResponse(received);
+    if (!received) {
+        linkCurrent.counters.timeouts++;
+        uartLinkTotals.timeouts++;
+    }
+    uartCaptureFrame(received ? CAPTURE_FLAG_RX : (CAPTURE_FLAG_RX | CAPTURE_FLAG_TIMEOUT),
+                     response.c_str(), response.length());
+}
+
 // Güvenli UART okuma
 String safeReadUARTResponse(unsigned long timeout) {
     String response = "";
@@ -132,6 +278,7 @@ String safeReadUARTResponse(unsigned long timeout) {
     while (millis() - startTime < timeout) {
         if (UART_PORT.available()) {
             char c = UART_PORT.read();
+            countRxByte();
             lastUARTActivity = millis();
             uartHealthy = true;
             dataStarted = true;
@@ -139,12 +286,14 @@ String safeReadUARTResponse(unsigned long timeout) {
             if (c == '\n' || c == '\r') {
                 if (response.length() > 0) {
                     uartStats.totalFramesReceived++;
+                    onFrameReceived(response);
                     return response;
                 }
             } else if (c >= 32 && c <= 126) {
                 response += c;
                 if (response.length() >= MAX_RESPONSE_LENGTH - 1) {
                     uartStats.totalFramesReceived++;
+                    onFrameReceived(response);
                     return response;
                 }
             }
@@ -153,6 +302,7 @@ String safeReadUARTResponse(unsigned long timeout) {
             if (!UART_PORT.available()) {
                 if (response.length() > 0) {
                     uartStats.totalFramesReceived++;
+                    onFrameReceived(response);
                     return response;
                 }
             }
@@ -163,28 +313,37 @@ String safeReadUARTResponse(unsigned long timeout) {
     if (response.length() == 0) {
         uartStats.timeoutErrors++;
     }
+    onFrameReceived(response);
     
     return response;
 }
 
 // Özel komut gönderme
-bool sendCustomCommand(const String& command, String& response, unsigned long timeout) {
+bool sendCustomCommand(const String& command, String& response, unsigned long timeout,
+                       UARTPriority priority, UARTCancelToken* cancel) {
     if (command.length() == 0 || command.length() > 100) {
         return false;
     }
     
-    if (!uartHealthy) {
+    if (!uartAcquire(priority, UART_ACQUIRE_TIMEOUT, cancel)) {
+        if (cancel != NULL && cancel->cancelled) {
+            addLog("🚫 İstemci ayrıldı, komut gönderilmedi: " + command, DEBUG, "UART");
+        } else {
+            addLog("⏳ UART hattı meşgul, komut zaman aşımı: " + command, WARN, "UART");
+        }
+        response = "";
+        return false;
+    }
+    
+    if (!uartHealthy && uartResetAllowed()) {
         resetUART();
     }
     
     clearUARTBuffer();
-    
-    UART_PORT.print(command);
-    UART_PORT.flush();
-    
-    uartStats.totalFramesSent++;
+    sendUARTFrame(command);
     
     response = safeReadUARTResponse(timeout == 0 ? UART_TIMEOUT : timeout);
+    uartRelease();
     
     bool success = response.length() > 0;
     updateUARTStats(success);
@@ -217,16 +376,18 @@ bool sendBaudRateCommand(long baudRate) {
             return false;
     }
     
-    clearUARTBuffer();
-    
-    UART_PORT.print(command);
-    UART_PORT.flush();
+    if (!uartAcquire(UART_PRIO_INTERACTIVE)) {
+        addLog("❌ UART hattı meşgul, baudrate kodu gönderilemedi", ERROR, "UART");
+        return false;
+    }
     
-    uartStats.totalFramesSent++;
+    clearUARTBuffer();
+    sendUARTFrame(command);
     
     addLog("dsPIC33EP'ye baudrate kodu gönderildi: " + command, INFO, "UART");
     
     String response = safeReadUARTResponse(2000);
+    uartRelease();
     
     if (response == "ACK" || response.indexOf("OK") >= 0) {
         addLog("✅ Baudrate kodu dsPIC33EP tarafından alındı", SUCCESS, "UART");
@@ -246,17 +407,21 @@ bool sendBaudRateCommand(long baudRate) {
 // ============ YENİ ARIZA SORGULAMA FONKSİYONLARI ============
 
 // Toplam arıza sayısını al (AN komutu)
-int getTotalFaultCount() {
-    clearUARTBuffer();
-    
-    UART_PORT.print("AN");
-    UART_PORT.flush();
+int getTotalFaultCount(UARTPriority priority, UARTCancelToken* cancel) {
+    if (!uartAcquire(priority, UART_ACQUIRE_TIMEOUT, cancel)) {
+        if (cancel == NULL || !cancel->cancelled) {
+            addLog("❌ UART hattı meşgul, arıza sayısı sorgulanamadı", ERROR, "UART");
+        }
+        return -1;
+    }
     
-    uartStats.totalFramesSent++;
+    clearUARTBuffer();
+    sendUARTFrame("AN");
     
     addLog("📊 Arıza sayısı sorgulanıyor (AN komutu)", DEBUG, "UART");
     
     String response = safeReadUARTResponse(2000);
+    uartRelease();
     
     if (response.length() >= 2 && response.charAt(0) == 'A') {
         addLog("📥 Gelen yanıt: " + response, DEBUG, "UART");
@@ -277,25 +442,31 @@ int getTotalFaultCount() {
     
     addLog("❌ Arıza sayısı alınamadı veya geçersiz format: " + response, ERROR, "UART");
     updateUARTStats(false);
-    return 0;
+    return -1;
 }
 
 // Belirli bir arıza adresini sorgula
-bool requestSpecificFault(int faultNumber) {
+bool requestSpecificFault(int faultNumber, UARTPriority priority, UARTCancelToken* cancel) {
+    if (!uartAcquire(priority, UART_ACQUIRE_TIMEOUT, cancel)) {
+        if (cancel == NULL || !cancel->cancelled) {
+            addLog("❌ UART hattı meşgul, arıza " + String(faultNumber) + " sorgulanamadı", ERROR, "UART");
+        }
+        lastResponse = "";
+        return false;
+    }
+    
     clearUARTBuffer();
     
     // Komutu formatla: 00001v, 00002v, ... formatında
     char command[10];
     sprintf(command, "%05dv", faultNumber);
     
-    UART_PORT.print(command);
-    UART_PORT.flush();
-    
-    uartStats.totalFramesSent++;
+    sendUARTFrame(command);
     
     addLog("🔍 Arıza komutu gönderildi: " + String(command), DEBUG, "UART");
     
     lastResponse = safeReadUARTResponse(3000);
+    uartRelease();
     
     if (lastResponse.length() > 0 && lastResponse != "E") {
         String preview = lastResponse.length() > 50 ? 
@@ -329,14 +500,18 @@ String getLastFaultResponse() {
 
 // Test komutu gönder
 bool sendTestCommand(const String& testCmd) {
-    clearUARTBuffer();
+    if (!uartAcquire(UART_PRIO_INTERACTIVE)) {
+        addLog("❌ UART hattı meşgul, test komutu gönderilemedi", WARN, "UART");
+        return false;
+    }
     
-    UART_PORT.print(testCmd);
-    UART_PORT.flush();
+    clearUARTBuffer();
+    sendUARTFrame(testCmd);
     
     addLog("🧪 Test komutu gönderildi: " + testCmd, DEBUG, "UART");
     
     String response = safeReadUARTResponse(3000);
+    uartRelease();
     
     if (response.length() > 0) {
         addLog("📡 Test yanıtı: " + response, DEBUG, "UART");
@@ -351,9 +526,16 @@ bool sendTestCommand(const String& testCmd) {
 void checkUARTHealth() {
     static unsigned long lastHealthCheck = 0;
     
+    rollUARTLinkWindow();
+    
     if (millis() - lastHealthCheck < 30000) {
         return;
     }
+    
+    // Sağlık kontrolü arka plan işi: hat meşgulse bir sonraki turda tekrar dene
+    if (!uartAcquire(UART_PRIO_BACKGROUND, 100)) {
+        return;
+    }
     lastHealthCheck = millis();
     
     // 5 dakika sessizlik kontrolü
@@ -364,10 +546,19 @@ void checkUARTHealth() {
         }
     }
     
-    // Çok fazla hata varsa reset
+    // Çok fazla hata varsa reset - ama yalnızca ESP32 tarafında bir sorun görünüyorsa.
+    // Sürücü hatasız ve sadece yanıtlar gecikiyorsa dsPIC yavaştır; reset yerine
+    // uart_pacer geri çekilir.
     if (uartErrorCount > 5) {
-        addLog("🔄 Çok fazla UART hatası (" + String(uartErrorCount) + "), reset yapılıyor...", WARN, "UART");
-        resetUART();
+        const char* diagnosis = getUARTLinkDiagnosis();
+        if (strcmp(diagnosis, "dspic-slow") == 0) {
+            addLog("⏳ " + String(uartErrorCount) + " yanıtsız komut, hat temiz - dsPIC yavaş, reset yapılmadı", WARN, "UART");
+            uartResetStats.suppressed++;
+            uartErrorCount = 0;
+        } else if (uartResetAllowed()) {
+            addLog("🔄 Çok fazla UART hatası (" + String(uartErrorCount) + ", " + diagnosis + "), reset yapılıyor...", WARN, "UART");
+            resetUART();
+        }
     }
     
     // Periyodik test
@@ -375,6 +566,8 @@ void checkUARTHealth() {
         addLog("🩺 UART sağlık testi yapılıyor...", INFO, "UART");
         testUARTConnection();
     }
+    
+    uartRelease();
 }
 
 // UART durumunu al
@@ -0,0 +1,77 @@
+// uart_pacer.cpp - dsPIC komutları için uyarlamalı aralık (AIMD)
+#include "uart_pacer.h"
+
+UARTPacerStats uartPacerStats = {PACER_INITIAL_GAP_MS, 0, 0, 0, 0, 0, 0, 0, 0};
+
+// Yalnızca hat sahibi yazar (uartAcquire ile korunur)
+static unsigned long lastFrameEndMs = 0;
+static unsigned long frameSentUs = 0;
+static unsigned long latencySamples = 0;
+
+void uartPaceWait() {
+    unsigned long elapsed = millis() - lastFrameEndMs;
+    uint32_t gap = uartPacerStats.gapMs;
+
+    if (lastFrameEndMs != 0 && elapsed < gap) {
+        unsigned long remaining = gap - elapsed;
+        uartPacerStats.waits++;
+        uartPacerStats.totalWaitMs += remaining;
+        delay(remaining);
+    }
+}
+
+void uartPacerFrameSent() {
+    frameSentUs = micros();
+}
+
+void uartPacerResponse(bool success) {
+    UARTPacerStats& s = uartPacerStats;
+    uint32_t latencyUs = micros() - frameSentUs;
+    lastFrameEndMs = millis();
+
+    if (!success) {
+        // Hata: boşluğu katla
+        s.errors++;
+        s.backoffs++;
+        uint32_t gap = s.gapMs * PACER_BACKOFF_FACTOR;
+        s.gapMs = gap > PACER_MAX_GAP_MS ? PACER_MAX_GAP_MS : gap;
+        return;
+    }
+
+    s.successes++;
+    s.lastLatencyUs = latencyUs;
+
+    // Isınma süresinden sonra ortalamanın belirgin üstündeki yanıt yavaş sayılır
+    bool slow = latencySamples >= 4 && latencyUs > s.avgLatencyUs * PACER_SLOW_FACTOR;
+
+    // Üssel ortalama (1/8 ağırlık)
+    if (latencySamples == 0) {
+        s.avgLatencyUs = latencyUs;
+    } else {
+        s.avgLatencyUs = s.avgLatencyUs - (s.avgLatencyUs >> 3) + (latencyUs >> 3);
+    }
+    latencySamples++;
+
+    if (slow) {
+        s.slowResponses++;
+        return; // Boşluğu koru
+    }
+
+    if (s.gapMs > PACER_MIN_GAP_MS + PACER_DECREASE_STEP_MS) {
+        s.gapMs -= PACER_DECREASE_STEP_MS;
+    } else {
+        s.gapMs = PACER_MIN_GAP_MS;
+    }
+}
+
+uint32_t uartPacerGapMs() {
+    return uartPacerStats.gapMs;
+}
+
+// UART reset sonrası dsPIC'in durumu bilinmez - temkinli başla
+void resetUARTPacer() {
+    uartPacerStats.gapMs = PACER_INITIAL_GAP_MS;
+    uartPacerStats.avgLatencyUs = 0;
+    latencySamples = 0;
+    lastFrameEndMs = millis();
+}
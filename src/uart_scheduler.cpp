@@ -0,0 +1,192 @@
+// uart_scheduler.cpp - UART hattı için öncelikli erişim
+#include "uart_scheduler.h"
+
+UARTQueueStats uartQueueStats[UART_PRIO_COUNT] = {};
+UARTCancelStats uartCancelStats = {0, 0};
+
+// Hat sahibi bilgisi - kritik bölge içinde okunur/yazılır
+static portMUX_TYPE schedulerMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t lineOwner = NULL;
+static int ownerDepth = 0;
+static UARTPriority ownerPriority = UART_PRIO_NORMAL;
+static int waitingCount[UART_PRIO_COUNT] = {0, 0, 0};
+
+// Kritik bölge içinde çağrılmalı
+static bool higherWaitingLocked(UARTPriority priority) {
+    for (int p = 0; p < priority; p++) {
+        if (waitingCount[p] > 0) return true;
+    }
+    return false;
+}
+
+static void recordWait(UARTPriority priority, uint32_t waitUs) {
+    UARTQueueStats& stats = uartQueueStats[priority];
+    stats.acquired++;
+    stats.totalWaitUs += waitUs;
+    stats.lastWaitUs = waitUs;
+    if (waitUs > stats.maxWaitUs) {
+        stats.maxWaitUs = waitUs;
+    }
+}
+
+bool uartTokenCancelled(UARTCancelToken* cancel) {
+    if (cancel == NULL) return false;
+    if (cancel->cancelled) return true;
+    
+    if (cancel->deadline != 0 && (long)(millis() - cancel->deadline) >= 0) {
+        cancel->cancelled = true;
+        cancel->expired = true;
+    } else if (cancel->isAlive != NULL && !cancel->isAlive(cancel->context)) {
+        cancel->cancelled = true;
+    }
+    return cancel->cancelled;
+}
+
+// Hattı al: boşsa ve daha öncelikli bekleyen yoksa hemen, aksi halde sırası gelene kadar bekle
+bool uartAcquire(UARTPriority priority, unsigned long maxWaitMs, UARTCancelToken* cancel) {
+    if (uartTokenCancelled(cancel)) {
+        uartCancelStats.droppedQueued++;
+        return false;
+    }
+    
+
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    unsigned long startUs = micros();
+    unsigned long startMs = millis();
+    bool queued = false;
+
+    while (true) {
+        portENTER_CRITICAL(&schedulerMux);
+
+        // Aynı task zaten sahipse (ör. setDateTimeToDsPIC -> sendCustomCommand) derinliği artır
+        if (lineOwner == self) {
+            ownerDepth++;
+            portEXIT_CRITICAL(&schedulerMux);
+            return true;
+        }
+
+        if (lineOwner == NULL && !higherWaitingLocked(priority)) {
+            lineOwner = self;
+            ownerDepth = 1;
+            ownerPriority = priority;
+            if (queued) {
+                waitingCount[priority]--;
+                uartQueueStats[priority].waiting = waitingCount[priority];
+            }
+            portEXIT_CRITICAL(&schedulerMux);
+
+            recordWait(priority, micros() - startUs);
+            return true;
+        }
+
+        if (!queued) {
+            waitingCount[priority]++;
+            uartQueueStats[priority].waiting = waitingCount[priority];
+            queued = true;
+        }
+
+        if (millis() - startMs >= maxWaitMs) {
+            waitingCount[priority]--;
+            uartQueueStats[priority].waiting = waitingCount[priority];
+            uartQueueStats[priority].timeouts++;
+            portEXIT_CRITICAL(&schedulerMux);
+            return false;
+        }
+
+        portEXIT_CRITICAL(&schedulerMux);
+        vTaskDelay(1);
+        
+        // Beklerken istemci gittiyse ya da süre dolduysa işi kuyruktan düşür
+        if (uartTokenCancelled(cancel)) {
+            portENTER_CRITICAL(&schedulerMux);
+            waitingCount[priority]--;
+            uartQueueStats[priority].waiting = waitingCount[priority];
+            portEXIT_CRITICAL(&schedulerMux);
+            uartCancelStats.droppedQueued++;
+            return false;
+        }
+    }
+}
+
+void uartRelease() {
+    portENTER_CRITICAL(&schedulerMux);
+    if (lineOwner == xTaskGetCurrentTaskHandle() && --ownerDepth <= 0) {
+        lineOwner = NULL;
+        ownerDepth = 0;
+    }
+    portEXIT_CRITICAL(&schedulerMux);
+}
+
+bool uartHigherPriorityWaiting() {
+    portENTER_CRITICAL(&schedulerMux);
+    bool waiting = lineOwner == xTaskGetCurrentTaskHandle() && higherWaitingLocked(ownerPriority);
+    portEXIT_CRITICAL(&schedulerMux);
+    return waiting;
+}
+
+// Toplu aktarımlar kayıtlar arasında çağırır. Daha öncelikli iş bekliyorsa hattı
+// tamamen bırakır, o iş bitince aynı öncelikle geri alır.
+bool uartYield(UARTCancelToken* cancel) {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    
+    if (uartTokenCancelled(cancel)) {
+        uartCancelStats.abortedBulk++;
+        return false;
+    }
+
+    portENTER_CRITICAL(&schedulerMux);
+    if (lineOwner != self || !higherWaitingLocked(ownerPriority)) {
+        portEXIT_CRITICAL(&schedulerMux);
+        return lineOwner == self;
+    }
+    UARTPriority priority = ownerPriority;
+    int depth = ownerDepth;
+    lineOwner = NULL;
+    ownerDepth = 0;
+    uartQueueStats[priority].yields++;
+    portEXIT_CRITICAL(&schedulerMux);
+
+    // Bekleyenin hattı alabilmesi için bir tick ver
+    vTaskDelay(1);
+
+    if (!uartAcquire(priority, UART_ACQUIRE_TIMEOUT, cancel)) {
+        if (cancel != NULL && cancel->cancelled) {
+            uartCancelStats.abortedBulk++;
+        }
+        return false;
+    }
+
+    portENTER_CRITICAL(&schedulerMux);
+    ownerDepth = depth;
+    portEXIT_CRITICAL(&schedulerMux);
+    return true;
+}
+
+const char* uartPriorityName(UARTPriority priority) {
+    switch (priority) {
+        case UART_PRIO_INTERACTIVE: return "interactive";
+        case UART_PRIO_NORMAL:      return "normal";
+        case UART_PRIO_BACKGROUND:  return "background";
+        default:                    return "unknown";
+    }
+}
+
+UARTPriority uartPriorityFromString(const String& name, UARTPriority fallback) {
+    if (name == "interactive") return UART_PRIO_INTERACTIVE;
+    if (name == "normal") return UART_PRIO_NORMAL;
+    if (name == "background") return UART_PRIO_BACKGROUND;
+    return fallback;
+}
+
+// Hattı şu an tutan task'ın adı (metrikler için)
+String uartLineOwnerName() {
+    portENTER_CRITICAL(&schedulerMux);
+    TaskHandle_t owner = lineOwner;
+    UARTPriority priority = ownerPriority;
+    portEXIT_CRITICAL(&schedulerMux);
+
+    if (owner == NULL) {
+        return "idle";
+    }
+    return String(pcTaskGetName(owner)) + " (" + uartPriorityName(priority) + ")";
+}
@@ -8,31 +8,32 @@
 #include "backup_restore.h"
 #include "password_policy.h"
 #include <LittleFS.h>
-#include <WebServer.h>
+#include "http_server.h"
 #include <ArduinoJson.h>
 #include <Preferences.h>
 #include <ESPmDNS.h>
 #include "datetime_handler.h"
 #include "fault_parser.h"
+#include "dspic_cache.h"
+#include "uart_pacer.h"
+#include "uart_capture.h"
+#include "static_assets.h"
+#include "state_version.h"
+#include "event_stream.h"
+#include "uart_console.h"
+#include "session_store.h"
+#include "response_cache.h"
+#include "gzip_stream.h"
+#include "admission.h"
 
-extern DateTimeData datetimeData;
 
 // UART istatistikleri - extern olarak kullan (uart_handler.cpp'de tanımlı)
 extern UARTStatistics uartStats;  // DÜZELTME: Burada tanımlama değil, extern kullanım
 
-// Rate limiting için global değişkenler
-struct RateLimitData {
-    IPAddress clientIP;
-    unsigned long requests[20];
-    int requestIndex = 0;
-    unsigned long lastReset = 0;
-};
-RateLimitData rateLimitData;
-
 extern String getCurrentDateTime();
 extern String getUptime();
 extern bool isTimeSynced();
-extern WebServer server;
+extern AppWebServer server;
 extern Settings settings;
 extern bool ntpConfigured;
 extern PasswordPolicy passwordPolicy;
@@ -43,39 +44,53 @@ static FaultRecord faultRecords[100]; // Maksimum 100 arıza kaydı
 static int faultCount = 0;
 
 
-// Security headers ekle
-void addSecurityHeaders() {
-    server.sendHeader("X-Content-Type-Options", "nosniff");
-    server.sendHeader("X-Frame-Options", "DENY");
-    server.sendHeader("X-XSS-Protection", "1; mode=block");
-    server.sendHeader("Referrer-Policy", "strict-origin-when-cross-origin");
-    server.sendHeader("Content-Security-Policy", "default-src 'self' 'unsafe-inline'");
-}
+// Durum alanı değişmediyse 304 gönderip true döner - çağıran JsonDocument kurmaz.
+// Tarayıcı yanıtı özel önbelleğinde tutar ve sonraki sorguda If-None-Match gönderir.
+static bool stateNotModified(StateDomain domain) {
+    String etag = stateETag(domain);
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "private, no-cache");
 
-// Rate limiting kontrolü
-bool checkRateLimit() {
-    IPAddress clientIP = server.client().remoteIP();
-    unsigned long now = millis();
-    
-    // Farklı IP veya 1 dakika geçmişse sıfırla
-    if (clientIP != rateLimitData.clientIP || now - rateLimitData.lastReset > 60000) {
-        rateLimitData.clientIP = clientIP;
-        rateLimitData.requestIndex = 0;
-        rateLimitData.lastReset = now;
+    if (etagMatches(server.header("If-None-Match"), etag)) {
+        server.send(304);
+        stateVersionStats[domain].notModified++;
+        return true;
     }
-    
-    // 1 dakikada 60 istekten fazlasına izin verme
-    if (rateLimitData.requestIndex >= 20) {
-        addLog("⚠️ Rate limit aşıldı: " + clientIP.toString(), WARN, "SECURITY");
-        return false;
+    stateVersionStats[domain].full++;
+    return false;
+}
+
+// İstek kapsamlı iptal: istemci ayrılırsa ya da süre dolarsa UART işi bırakılır
+#define REQUEST_UART_BUDGET 15000   // ms - tek komutluk istekler
+#define BULK_UART_BUDGET 60000      // ms - toplu arıza aktarımı
+
+// Değer önbellekteyse web task'ında hemen yanıtla, yoksa UART worker'ına devret
+static void completeDsPICRequest(DsPICCacheItem item, DeferredHandler handler) {
+    if (server.arg("refresh") != "1" && dspicCacheHasValue(item)) {
+        server.completeInline(handler);
+    } else {
+        server.deferRequest(handler, REQUEST_UART_BUDGET);
     }
-    
-    rateLimitData.requests[rateLimitData.requestIndex++] = now;
-    return true;
+}
+
+// Önbellekten dönen değerin yaşı (saniye) - arayüz bayatlığı gösterir
+static void addCacheAge(JsonDocument& doc, DsPICCacheItem item) {
+    doc["age"] = dspicCacheAge(item) / 1000;
+    doc["stale"] = dspicCacheIsStale(item);
+}
+
+// Security headers ekle
+void addSecurityHeaders() {
+    server.sendSecurityHeaders();
 }
 
 // Device Info API
 void handleDeviceInfoAPI() {
+    addSecurityHeaders();
+    if (responseCacheServe(RESPONSE_CACHE_DEVICE_INFO)) {
+        return;
+    }
+    
     JsonDocument doc;
     doc["ip"] = ETH.localIP().toString();
     doc["mac"] = ETH.macAddress();
@@ -84,11 +99,7 @@ void handleDeviceInfoAPI() {
     doc["version"] = "v5.2";
     doc["model"] = "WT32-ETH01";
     
-    String output;
-    serializeJson(doc, output);
-    
-    addSecurityHeaders();
-    server.send(200, "application/json", output);
+    responseCacheStore(RESPONSE_CACHE_DEVICE_INFO, doc);
 }
 
 // System Info API (Auth gerekli)
@@ -98,9 +109,9 @@ void handleSystemInfoAPI() {
         return;
     }
     
-    // Rate limiting
-    if (!checkRateLimit()) {
-        server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
+    // Heap sorguları SYSTEM_INFO_RESPONSE_TTL, LittleFS taraması FILESYSTEM_USAGE_TTL boyunca tekrarlanmaz
+    addSecurityHeaders();
+    if (responseCacheServe(RESPONSE_CACHE_SYSTEM_INFO)) {
         return;
     }
     
@@ -134,18 +145,15 @@ void handleSystemInfoAPI() {
     doc["uart"]["baudRate"] = 250000;  // settings.currentBaudRate yerine sabit değer
     
     // File system info
-    size_t totalBytes = LittleFS.totalBytes();
-    size_t usedBytes = LittleFS.usedBytes();
+    size_t totalBytes = 0;
+    size_t usedBytes = 0;
+    cachedFilesystemUsage(totalBytes, usedBytes);
     doc["filesystem"]["type"] = "LittleFS";
     doc["filesystem"]["total"] = totalBytes;
     doc["filesystem"]["used"] = usedBytes;
     doc["filesystem"]["free"] = totalBytes - usedBytes;
     
-    String output;
-    serializeJson(doc, output);
-    
-    addSecurityHeaders();
-    server.send(200, "application/json", output);
+    responseCacheStore(RESPONSE_CACHE_SYSTEM_INFO, doc);
 }
 
 // Network Configuration API - GET
@@ -156,6 +164,7 @@ void handleGetNetworkAPI() {
     }
     
     addSecurityHeaders();
+    if (stateNotModified(STATE_NETWORK)) return;
     
     JsonDocument doc;
     
@@ -175,10 +184,7 @@ void handleGetNetworkAPI() {
     // Şu an için her zaman static IP olarak göster
     doc["dhcp"] = false;
     
-    String output;
-    serializeJson(doc, output);
-    
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 // Network Configuration API - POST (Basit versiyon)
@@ -245,6 +251,9 @@ void handleNotificationAPI() {
         return;
     }
     
+    addSecurityHeaders();
+    if (stateNotModified(STATE_LOGS)) return;
+    
     JsonDocument doc;
     JsonArray notifications = doc.to<JsonArray>();
     
@@ -253,6 +262,7 @@ void handleNotificationAPI() {
     extern int totalLogs;
     int notificationCount = 0;
     
+    lockLogs();
     for (int i = 0; i < totalLogs && notificationCount < 10; i++) {
         int idx = (logIndex - 1 - i + 50) % 50;
         if (logs[idx].level == ERROR || logs[idx].level == WARN) {
@@ -265,14 +275,11 @@ void handleNotificationAPI() {
             notificationCount++;
         }
     }
+    unlockLogs();
     
     doc["count"] = notificationCount;
     
-    String output;
-    serializeJson(doc, output);
-    
-    addSecurityHeaders();
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 // System Reboot API
@@ -300,8 +307,10 @@ void handleGetDateTimeAPI() {
     
     JsonDocument doc;
     
-    // Mevcut datetime verisi
-    doc["isValid"] = isDateTimeDataValid();
+    // Mevcut datetime verisi - uartTask yenilerken yazabilir, kopya üzerinden okunur
+    DateTimeData datetimeData;
+    getDateTimeSnapshot(datetimeData);
+    doc["isValid"] = datetimeData.isValid && datetimeData.date.length() > 0 && datetimeData.time.length() > 0;
     doc["date"] = datetimeData.date;
     doc["time"] = datetimeData.time;
     doc["rawData"] = datetimeData.rawData;
@@ -318,70 +327,53 @@ void handleGetDateTimeAPI() {
     // ESP32 sistem saati
     doc["esp32DateTime"] = getCurrentESP32DateTime();
     
-    String output;
-    serializeJson(doc, output);
-    
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 // DateTime bilgisi güncelle - POST /api/datetime/fetch  
-void handleFetchDateTimeAPI() {
-    if (!checkSession()) {
-        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+static void finishFetchDateTime(DeferredRequest& request) {
+    // Taze değer varsa UART beklenmez; refresh=1 doğrudan dsPIC'e sorar
+    bool success = getCachedDateTime(UART_PRIO_INTERACTIVE, &request.cancel, request.arg("refresh") == "1");
+    if (server.deferredCancelled(request)) {
         return;
     }
     
-    addSecurityHeaders();
-    
-    addLog("DateTime bilgisi dsPIC'ten çekiliyor...", INFO, "DATETIME");
-    
-    bool success = requestDateTimeFromDsPIC();
-    
     JsonDocument doc;
     doc["success"] = success;
     
     if (success) {
         doc["message"] = "Tarih-saat bilgisi başarıyla güncellendi";
+        DateTimeData datetimeData;
+        getDateTimeSnapshot(datetimeData);
         doc["date"] = datetimeData.date;
         doc["time"] = datetimeData.time;
         doc["rawData"] = datetimeData.rawData;
+        addCacheAge(doc, DSPIC_CACHE_DATETIME);
     } else {
         doc["message"] = "Tarih-saat bilgisi alınamadı";
         doc["error"] = "dsPIC'ten yanıt alınamadı veya format geçersiz";
     }
     
-    String output;
-    serializeJson(doc, output);
-    
-    server.send(success ? 200 : 500, "application/json", output);
+    server.sendDeferredJson(request, success ? 200 : 500, doc);
 }
 
-// DateTime ayarla - POST /api/datetime/set
-void handleSetDateTimeAPI() {
+void handleFetchDateTimeAPI() {
     if (!checkSession()) {
         server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
         return;
     }
     
-    addSecurityHeaders();
-    
-    String manualDate = server.arg("manualDate");  // Format: 2025-02-27
-    String manualTime = server.arg("manualTime");  // Format: 11:22:33
-    
-    // Input validation
-    if (manualDate.length() == 0 || manualTime.length() == 0) {
-        server.send(400, "application/json", "{\"error\":\"Tarih ve saat alanları boş olamaz\"}");
-        return;
-    }
-    
-    if (!validateDateTime(manualDate, manualTime)) {
-        server.send(400, "application/json", "{\"error\":\"Geçersiz tarih veya saat formatı\"}");
-        return;
-    }
+    completeDsPICRequest(DSPIC_CACHE_DATETIME, finishFetchDateTime);
+}
+
+// DateTime ayarla - POST /api/datetime/set
+static void finishSetDateTime(DeferredRequest& request) {
+    String manualDate = request.arg("manualDate");
+    String manualTime = request.arg("manualTime");
     
     addLog("Manual tarih-saat ayarlanıyor: " + manualDate + " " + manualTime, INFO, "DATETIME");
     
-    bool success = setDateTimeToDsPIC(manualDate, manualTime);
+    bool success = setDateTimeToDsPIC(manualDate, manualTime, UART_PRIO_INTERACTIVE);
     
     JsonDocument doc;
     doc["success"] = success;
@@ -397,14 +389,10 @@ void handleSetDateTimeAPI() {
         doc["error"] = "Komut gönderimi başarısız";
     }
     
-    String output;
-    serializeJson(doc, output);
-    
-    server.send(success ? 200 : 500, "application/json", output);
+    server.sendDeferredJson(request, success ? 200 : 500, doc);
 }
 
-// ESP32 saati ile senkronize et - POST /api/datetime/sync-esp32
-void handleSyncESP32API() {
+void handleSetDateTimeAPI() {
     if (!checkSession()) {
         server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
         return;
@@ -412,9 +400,28 @@ void handleSyncESP32API() {
     
     addSecurityHeaders();
     
+    String manualDate = server.arg("manualDate");  // Format: 2025-02-27
+    String manualTime = server.arg("manualTime");  // Format: 11:22:33
+    
+    // Input validation
+    if (manualDate.length() == 0 || manualTime.length() == 0) {
+        server.send(400, "application/json", "{\"error\":\"Tarih ve saat alanları boş olamaz\"}");
+        return;
+    }
+    
+    if (!validateDateTime(manualDate, manualTime)) {
+        server.send(400, "application/json", "{\"error\":\"Geçersiz tarih veya saat formatı\"}");
+        return;
+    }
+    
+    server.deferRequest(finishSetDateTime, REQUEST_UART_BUDGET);
+}
+
+// ESP32 saati ile senkronize et - POST /api/datetime/sync-esp32
+static void finishSyncESP32(DeferredRequest& request) {
     addLog("ESP32 saati ile senkronizasyon başlatılıyor", INFO, "DATETIME");
     
-    bool success = syncWithESP32Time();
+    bool success = syncWithESP32Time(UART_PRIO_INTERACTIVE);
     
     JsonDocument doc;
     doc["success"] = success;
@@ -427,31 +434,22 @@ void handleSyncESP32API() {
         doc["error"] = "ESP32 sistem saati alınamadı veya komut gönderimi başarısız";
     }
     
-    String output;
-    serializeJson(doc, output);
-    
-    server.send(success ? 200 : 500, "application/json", output);
+    server.sendDeferredJson(request, success ? 200 : 500, doc);
 }
 
-// Şimdiki zamanı ayarla (client-side JavaScript Date) - POST /api/datetime/set-current
-void handleSetCurrentTimeAPI() {
+void handleSyncESP32API() {
     if (!checkSession()) {
         server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
         return;
     }
     
-    addSecurityHeaders();
-    
-    // Client'tan gelen timestamp (JavaScript Date.now())
-    String clientTimestamp = server.arg("timestamp");
-    
-    if (clientTimestamp.length() == 0) {
-        server.send(400, "application/json", "{\"error\":\"Timestamp parametresi gerekli\"}");
-        return;
-    }
-    
+    server.deferRequest(finishSyncESP32, REQUEST_UART_BUDGET);
+}
+
+// Şimdiki zamanı ayarla (client-side JavaScript Date) - POST /api/datetime/set-current
+static void finishSetCurrentTime(DeferredRequest& request) {
     // Client timestamp'i parse et (milisaniye)
-    unsigned long long timestamp = clientTimestamp.toInt();
+    unsigned long long timestamp = request.arg("timestamp").toInt();
     time_t clientTime = timestamp / 1000; // Saniyeye çevir
     
     struct tm* timeinfo = localtime(&clientTime);
@@ -466,7 +464,7 @@ void handleSetCurrentTimeAPI() {
     
     addLog("Client'tan alınan zaman ayarlanıyor: " + currentDate + " " + currentTime, INFO, "DATETIME");
     
-    bool success = setDateTimeToDsPIC(currentDate, currentTime);
+    bool success = setDateTimeToDsPIC(currentDate, currentTime, UART_PRIO_INTERACTIVE);
     
     JsonDocument doc;
     doc["success"] = success;
@@ -478,10 +476,24 @@ void handleSetCurrentTimeAPI() {
         doc["message"] = "Zaman ayarlaması başarısız";
     }
     
-    String output;
-    serializeJson(doc, output);
+    server.sendDeferredJson(request, success ? 200 : 500, doc);
+}
+
+void handleSetCurrentTimeAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+    
+    addSecurityHeaders();
+    
+    // Client'tan gelen timestamp (JavaScript Date.now())
+    if (server.arg("timestamp").length() == 0) {
+        server.send(400, "application/json", "{\"error\":\"Timestamp parametresi gerekli\"}");
+        return;
+    }
     
-    server.send(success ? 200 : 500, "application/json", output);
+    server.deferRequest(finishSetCurrentTime, REQUEST_UART_BUDGET);
 }
 
 // Komut geçmişi - GET /api/datetime/history
@@ -522,10 +534,7 @@ void handleDateTimePreviewAPI() {
         doc["error"] = "Geçersiz tarih veya saat formatı";
     }
     
-    String output;
-    serializeJson(doc, output);
-    
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 // mDNS güncelleme (teias-eklim.local)
@@ -540,24 +549,131 @@ void updateMDNS() {
     }
 }
 
+// ETag + Cache-Control başlıklarını ekler; If-None-Match eşleşirse 304 gönderip true döner
+static bool sendNotModified(const String& etag, const String& version) {
+    bool versioned = server.hasArg("v") && server.arg("v") == version;
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", versioned ? STATIC_CACHE_IMMUTABLE : STATIC_CACHE_REVALIDATE);
+
+    if (etagMatches(server.header("If-None-Match"), etag)) {
+        server.send(304);
+        staticAssetStats.notModified++;
+        return true;
+    }
+    return false;
+}
+
+size_t readMemoryContent(void* context, size_t offset, uint8_t* buffer, size_t length) {
+    memcpy(buffer, (const uint8_t*)context + offset, length);
+    return length;
+}
+
+static size_t readFileContent(void* context, size_t offset, uint8_t* buffer, size_t length) {
+    File* file = static_cast<File*>(context);
+    if (file->position() != offset && !file->seek(offset)) return 0;
+    return file->read(buffer, length);
+}
+
+// If-Range yalnızca güçlü karşılaştırma ile ETag kabul eder; tarih biçimi ve zayıf ETag
+// tutmaz sayılır - istemci eskimiş parçayı birleştirmek yerine tam gövdeyi alır.
+bool sendRange(const char* contentType, size_t total, const String& etag, const char* contentEncoding,
+               ContentReader reader, void* context) {
+    server.sendHeader("Accept-Ranges", "bytes");
+    String range = server.header("Range");
+    if (range.length() == 0) return false;
+
+    String ifRange = server.header("If-Range");
+    ifRange.trim();
+    if (ifRange.length() > 0 && (etag.length() == 0 || etag.startsWith("W/") || ifRange != etag)) {
+        rangeStats.ifRangeMismatch++;
+        return false;
+    }
+
+    size_t start = 0;
+    size_t length = 0;
+    RangeResult result = parseByteRange(range, total, start, length);
+    if (result == RANGE_NONE) return false;
+    if (result == RANGE_UNSATISFIABLE) {
+        server.sendHeader("Content-Range", "bytes */" + String(total));
+        server.send(416, "text/plain", "Range Not Satisfiable");
+        rangeStats.unsatisfiable++;
+        return true;
+    }
+
+    if (contentEncoding != NULL) {
+        server.sendHeader("Content-Encoding", contentEncoding);
+    }
+    server.sendHeader("Content-Range", "bytes " + String(start) + "-" + String(start + length - 1) +
+                                       "/" + String(total));
+    server.setContentLength(length);
+    server.send(206, contentType, "");
+
+    uint8_t chunk[512];
+    size_t sent = 0;
+    while (sent < length) {
+        size_t n = length - sent;
+        if (n > sizeof(chunk)) n = sizeof(chunk);
+        n = reader(context, start + sent, chunk, n);
+        if (n == 0) break;
+        server.sendContent((const char*)chunk, n);
+        sent += n;
+    }
+    rangeStats.partial++;
+    rangeStats.partialBytes += sent;
+    return true;
+}
+
+// Önce firmware'e gömülü kopya (dosya sistemi erişimi yok), sonra LittleFS manifesti.
+// streamFile() ".gz" uzantısını görünce Content-Encoding: gzip başlığını kendisi ekler.
+// Range, gönderilen (gzip'li) gövdenin baytlarına uygulanır.
 void serveStaticFile(const String& path, const String& contentType) {
-    String pathWithGz = path + ".gz";
-    if (LittleFS.exists(pathWithGz)) {
-        File file = LittleFS.open(pathWithGz, "r");
+    const EmbeddedAsset* embedded = findEmbeddedAsset(path);
+    if (embedded != NULL) {
+        if (sendNotModified(embedded->etag, embedded->version)) return;
+        if (sendRange(contentType.c_str(), embedded->length, embedded->etag, "gzip",
+                      readMemoryContent, (void*)embedded->data)) return;
         server.sendHeader("Content-Encoding", "gzip");
-        server.streamFile(file, contentType);
-        file.close();
+        server.send_P(200, contentType.c_str(), (PGM_P)embedded->data, embedded->length);
+        staticAssetStats.embedded++;
         return;
     }
 
-    if (LittleFS.exists(path)) {
+    const StaticAsset* asset = findStaticAsset(path);
+
+    if (asset == NULL) {
+        // Derleme aşaması çalışmadan yüklenmiş ham data/ imajı - doğrulayıcı boyut ve
+        // son yazma zamanından türetilir (yalnızca If-Range için, önbellek politikası yok)
+        if (!LittleFS.exists(path)) {
+            server.send(404, "text/plain", "404: Not Found");
+            return;
+        }
         File file = LittleFS.open(path, "r");
-        server.streamFile(file, contentType);
+        String etag = "\"" + String((uint32_t)file.size(), HEX) + "-" +
+                      String((uint32_t)file.getLastWrite(), HEX) + "\"";
+        server.sendHeader("ETag", etag);
+        if (!sendRange(contentType.c_str(), file.size(), etag, path.endsWith(".gz") ? "gzip" : NULL,
+                       readFileContent, &file)) {
+            server.streamFile(file, contentType);
+        }
         file.close();
+        staticAssetStats.unindexed++;
         return;
     }
 
-    server.send(404, "text/plain", "404: Not Found");
+    if (sendNotModified(asset->etag, asset->version)) return;
+
+    File file = LittleFS.open(path + ".gz", "r");
+    if (!file) {
+        server.send(404, "text/plain", "404: Not Found");
+        return;
+    }
+    if (sendRange(contentType.c_str(), file.size(), asset->etag, "gzip", readFileContent, &file)) {
+        file.close();
+        return;
+    }
+    server.streamFile(file, contentType);
+    file.close();
+    staticAssetStats.served++;
 }
 
 String getUptime() {
@@ -585,20 +701,17 @@ void handleStatusAPI() {
     doc["freeHeap"] = ESP.getFreeHeap();
     doc["totalHeap"] = ESP.getHeapSize();
 
-    String output;
-    serializeJson(doc, output);
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 void handleGetSettingsAPI() {
     if (!checkSession()) { server.send(401); return; }
+    if (stateNotModified(STATE_SETTINGS)) return;
     JsonDocument doc;
     doc["deviceName"] = settings.deviceName;
     doc["tmName"] = settings.transformerStation;
     doc["username"] = settings.username;
-    String output;
-    serializeJson(doc, output);
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 void handlePostSettingsAPI() {
@@ -611,52 +724,42 @@ void handlePostSettingsAPI() {
 }
 
 // YENİ: Arıza sayısını al API'si
-void handleGetFaultCountAPI() {
-    if (!checkSession()) {
-        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
-        return;
+static void finishFaultCount(DeferredRequest& request) {
+    int count = 0;
+    bool success = getCachedFaultCount(count, UART_PRIO_NORMAL, &request.cancel, request.arg("refresh") == "1");
+    if (server.deferredCancelled(request)) {
+        return; // İstemci ayrıldı ya da süre doldu (504 yazıldı)
     }
     
-    addLog("📊 Arıza sayısı sorgulanıyor", INFO, "API");
-    
-    int count = getTotalFaultCount(); // uart_handler.cpp'deki yeni fonksiyon
-    
     JsonDocument doc;
-    doc["success"] = (count > 0);
+    doc["success"] = success;
     doc["count"] = count;
-    doc["message"] = count > 0 ? 
-        "Toplam " + String(count) + " arıza bulundu" : 
-        "Arıza sayısı alınamadı";
+    doc["message"] = !success ? "Arıza sayısı alınamadı" :
+        count > 0 ? "Toplam " + String(count) + " arıza bulundu" : "Sistemde arıza kaydı yok";
+    addCacheAge(doc, DSPIC_CACHE_FAULT_COUNT);
     
-    String output;
-    serializeJson(doc, output);
-    
-    addSecurityHeaders();
-    server.send(200, "application/json", output);
+    server.sendDeferredJson(request, 200, doc);
 }
 
-// YENİ: Belirli bir arıza kaydını al
-void handleGetSpecificFaultAPI() {
+void handleGetFaultCountAPI() {
     if (!checkSession()) {
         server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
         return;
     }
     
-    String faultNoStr = server.arg("faultNo");
-    if (faultNoStr.length() == 0) {
-        server.send(400, "application/json", "{\"error\":\"faultNo parameter required\"}");
-        return;
-    }
-    
-    int faultNo = faultNoStr.toInt();
-    if (faultNo < 1 || faultNo > 9999) {
-        server.send(400, "application/json", "{\"error\":\"Invalid fault number\"}");
-        return;
-    }
+    completeDsPICRequest(DSPIC_CACHE_FAULT_COUNT, finishFaultCount);
+}
+
+// YENİ: Belirli bir arıza kaydını al
+static void finishSpecificFault(DeferredRequest& request) {
+    int faultNo = request.arg("faultNo").toInt();
     
     addLog("🔍 Arıza " + String(faultNo) + " sorgulanıyor", INFO, "API");
     
-    bool success = requestSpecificFault(faultNo);
+    bool success = requestSpecificFault(faultNo, UART_PRIO_NORMAL, &request.cancel);
+    if (server.deferredCancelled(request)) {
+        return;
+    }
     
     if (success) {
         String response = getLastFaultResponse();
@@ -667,50 +770,73 @@ void handleGetSpecificFaultAPI() {
         doc["rawData"] = response;
         doc["length"] = response.length();
         
-        String output;
-        serializeJson(doc, output);
-        
-        server.send(200, "application/json", output);
+        server.sendDeferredJson(request, 200, doc);
     } else {
-        server.send(500, "application/json", 
+        server.sendDeferred(request, 500, "application/json", 
             "{\"success\":false,\"error\":\"Arıza kaydı alınamadı\"}");
     }
 }
 
-// Mevcut handleParsedFaultAPI fonksiyonunu GÜNCELLE
-void handleParsedFaultAPI() {
+void handleGetSpecificFaultAPI() {
     if (!checkSession()) {
         server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
         return;
     }
     
-    String action = server.arg("action");
+    String faultNoStr = server.arg("faultNo");
+    if (faultNoStr.length() == 0) {
+        server.send(400, "application/json", "{\"error\":\"faultNo parameter required\"}");
+        return;
+    }
+    
+    int faultNo = faultNoStr.toInt();
+    if (faultNo < 1 || faultNo > 9999) {
+        server.send(400, "application/json", "{\"error\":\"Invalid fault number\"}");
+        return;
+    }
+    
+    server.deferRequest(finishSpecificFault, REQUEST_UART_BUDGET);
+}
+
+// Parse edilmiş arıza verisi - count/get/range UART worker'ında çalışır
+static void finishParsedFault(DeferredRequest& request) {
+    String action = request.arg("action");
+    
+    // Tarayıcı sayfadan ayrılırsa kalan UART işleri ve serileştirme atlanır
+    UARTCancelToken& cancel = request.cancel;
     
     if (action == "count") {
         // Toplam arıza sayısını döndür
-        int count = getTotalFaultCount();
+        int count = 0;
+        bool success = getCachedFaultCount(count, UART_PRIO_NORMAL, &cancel, request.arg("refresh") == "1");
+        if (server.deferredCancelled(request)) {
+            return;
+        }
         
         JsonDocument doc;
-        doc["success"] = (count > 0);
+        doc["success"] = success;
         doc["count"] = count;
-        doc["message"] = count > 0 ? 
-            String(count) + " adet arıza bulundu" : 
-            "Sistemde arıza kaydı yok";
+        doc["message"] = !success ? "Arıza sayısı alınamadı" :
+            count > 0 ? String(count) + " adet arıza bulundu" : "Sistemde arıza kaydı yok";
+        addCacheAge(doc, DSPIC_CACHE_FAULT_COUNT);
         
-        String output;
-        serializeJson(doc, output);
-        server.send(200, "application/json", output);
+        server.sendDeferredJson(request, 200, doc);
         
     } else if (action == "get") {
         // Belirli bir arıza kaydını al ve parse et
-        String faultNoStr = server.arg("faultNo");
+        String faultNoStr = request.arg("faultNo");
         if (faultNoStr.length() == 0) {
-            server.send(400, "application/json", "{\"error\":\"faultNo parameter required\"}");
+            server.sendDeferred(request, 400, "application/json", "{\"error\":\"faultNo parameter required\"}");
             return;
         }
         
         int faultNo = faultNoStr.toInt();
-        if (requestSpecificFault(faultNo)) {
+        bool received = requestSpecificFault(faultNo, UART_PRIO_NORMAL, &cancel);
+        if (server.deferredCancelled(request)) {
+            return;
+        }
+        
+        if (received) {
             String rawResponse = getLastFaultResponse();
             FaultRecord fault = parseFaultData(rawResponse);
             
@@ -727,51 +853,141 @@ void handleParsedFaultAPI() {
                 doc["fault"]["millisecond"] = fault.millisecond;
                 doc["fault"]["rawData"] = fault.rawData;
                 
-                String output;
-                serializeJson(doc, output);
-                server.send(200, "application/json", output);
+                server.sendDeferredJson(request, 200, doc);
             } else {
-                server.send(400, "application/json", 
+                server.sendDeferred(request, 400, "application/json", 
                     "{\"success\":false,\"error\":\"" + fault.errorMessage + "\"}");
             }
         } else {
-            server.send(500, "application/json", 
+            server.sendDeferred(request, 500, "application/json", 
                 "{\"success\":false,\"error\":\"Arıza kaydı alınamadı\"}");
         }
         
+    } else if (action == "range") {
+        // Toplu aktarım: from..to arası kayıtları tek istekte al
+        int from = request.arg("from").toInt();
+        int to = request.arg("to").toInt();
+        if (from < 1 || to < from || to - from >= 20) {
+            server.sendDeferred(request, 400, "application/json", "{\"error\":\"Invalid range (max 20 records)\"}");
+            return;
+        }
+        // Bellek sıkışıkken sayfa küçülür; istemci yanıttaki "to"dan devam eder
+        bool degraded = admissionDegraded();
+        if (degraded && to - from >= ADMISSION_DEGRADED_FAULT_PAGE) {
+            to = from + ADMISSION_DEGRADED_FAULT_PAGE - 1;
+        }
+        
+        JsonDocument doc;
+        JsonArray faults = doc["faults"].to<JsonArray>();
+        int received = 0;
+        
+        // Hattı baştan sona tut, ama her kayıttan sonra öncelikli işlere yol ver
+        if (!uartAcquire(UART_PRIO_NORMAL, UART_ACQUIRE_TIMEOUT, &cancel)) {
+            if (!server.deferredCancelled(request)) {
+                server.sendDeferred(request, 503, "application/json", "{\"success\":false,\"error\":\"UART hattı meşgul\"}");
+            }
+            return;
+        }
+        
+        for (int faultNo = from; faultNo <= to; faultNo++) {
+            JsonObject item = faults.add<JsonObject>();
+            item["faultNo"] = faultNo;
+            
+            if (requestSpecificFault(faultNo, UART_PRIO_NORMAL, &cancel)) {
+                FaultRecord fault = parseFaultData(getLastFaultResponse());
+                item["success"] = fault.isValid;
+                if (fault.isValid) {
+                    item["pinNumber"] = fault.pinNumber;
+                    item["pinType"] = fault.pinType;
+                    item["pinName"] = fault.pinName;
+                    item["dateTime"] = fault.dateTime;
+                    item["duration"] = formatDuration(fault.duration);
+                    item["durationSeconds"] = fault.duration;
+                    item["millisecond"] = fault.millisecond;
+                    received++;
+                } else {
+                    item["error"] = fault.errorMessage;
+                }
+                item["rawData"] = fault.rawData;
+            } else {
+                item["success"] = false;
+                item["error"] = "Arıza kaydı alınamadı";
+            }
+            
+            // Kayıtlar arasında: öncelikli işe yol ver, istemci gittiyse dur
+            if (!uartYield(&cancel)) {
+                break;
+            }
+        }
+        uartRelease();
+        
+        if (cancel.cancelled) {
+            addLog("🚫 Toplu arıza aktarımı " + String(cancel.expired ? "süre dolduğu" : "istemci ayrıldığı") +
+                   " için durduruldu (" + String(received) + " kayıt)", INFO, "API");
+            server.deferredCancelled(request);
+            return;
+        }
+        
+        doc["success"] = received > 0;
+        doc["from"] = from;
+        doc["to"] = to;
+        doc["received"] = received;
+        doc["paceMs"] = uartPacerGapMs();
+        if (degraded) {
+            doc["degraded"] = true;
+        }
+        
+        server.sendDeferredJson(request, 200, doc);
+    }
+}
+
+// Mevcut handleParsedFaultAPI fonksiyonunu GÜNCELLE
+void handleParsedFaultAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+    
+    String action = server.arg("action");
+    
+    if (action == "count") {
+        completeDsPICRequest(DSPIC_CACHE_FAULT_COUNT, finishParsedFault);
+        
+    } else if (action == "get" || action == "range") {
+        server.deferRequest(finishParsedFault, action == "range" ? BULK_UART_BUDGET : REQUEST_UART_BUDGET);
+        
     } else if (action == "clear") {
         // Arıza kayıtlarını temizle (sadece ESP32 tarafında)
         faultCount = 0;
+        dspicCacheInvalidate(DSPIC_CACHE_FAULT_COUNT);
         server.send(200, "application/json", 
             "{\"success\":true,\"message\":\"Arıza kayıtları temizlendi\"}");
             
     } else {
         server.send(400, "application/json", 
-            "{\"error\":\"Invalid action. Use: count, get, or clear\"}");
+            "{\"error\":\"Invalid action. Use: count, get, range, or clear\"}");
     }
 }
 
 // ✅ handleUARTTestAPI fonksiyonu
-void handleUARTTestAPI() {
-    if (!checkSession()) {
-        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
-        return;
-    }
-    
-    addLog("🧪 UART test başlatılıyor...", INFO, "WEB");
-    
+static void finishUARTTest(DeferredRequest& request) {
     JsonDocument doc;
     doc["uartHealthy"] = uartHealthy;
     doc["baudRate"] = 250000;
     
-    // Basit test komutu gönder
+    // Basit test komutu - son sonuç taze ise hat meşgul edilmez
     String testResponse;
-    bool testResult = sendCustomCommand("TEST", testResponse, 2000);
+    bool testResult = false;
+    getCachedLinkHealth(testResult, testResponse, UART_PRIO_NORMAL, &request.cancel, request.arg("refresh") == "1");
+    if (server.deferredCancelled(request)) {
+        return;
+    }
     
     doc["testCommand"] = "TEST";
     doc["testSuccess"] = testResult;
     doc["testResponse"] = testResponse;
     doc["responseLength"] = testResponse.length();
+    addCacheAge(doc, DSPIC_CACHE_LINK_HEALTH);
     
     // İstatistikler
     doc["stats"]["sent"] = uartStats.totalFramesSent;
@@ -779,21 +995,486 @@ void handleUARTTestAPI() {
     doc["stats"]["errors"] = uartStats.frameErrors + uartStats.checksumErrors + uartStats.timeoutErrors;
     doc["stats"]["successRate"] = uartStats.successRate;
     
-    String output;
-    serializeJson(doc, output);
+    server.sendDeferredJson(request, 200, doc);
+}
+
+void handleUARTTestAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+    
+    completeDsPICRequest(DSPIC_CACHE_LINK_HEALTH, finishUARTTest);
+}
+
+// Manuel UART komutu - POST /api/uart/send (kayıt yolu setupWebRoutes içinde)
+static void finishUARTSend(DeferredRequest& request) {
+    String command = request.arg("command");
+    
+    // Kullanıcı komutu varsayılan olarak öne geçer; toplu istemciler priority ile düşürebilir
+    UARTPriority priority = uartPriorityFromString(request.arg("priority"), UART_PRIO_INTERACTIVE);
+    
+    addLog("🧪 Manuel komut gönderiliyor: " + command, INFO, "UART");
+    
+    String response;
+    bool success = sendCustomCommand(command, response, 3000, priority, &request.cancel);
+    if (server.deferredCancelled(request)) {
+        return;
+    }
+    
+    JsonDocument doc;
+    doc["command"] = command;
+    doc["success"] = success;
+    doc["response"] = response;
+    doc["responseLength"] = response.length();
+    doc["timestamp"] = getFormattedTimestamp();
+    doc["paceMs"] = uartPacerGapMs(); // Toplu istemciler bir sonraki komuttan önce bu kadar bekler
+    
+    server.sendDeferredJson(request, 200, doc);
+}
+
+// UART kuyruk metrikleri - GET /api/uart/metrics
+void handleUARTMetricsAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+    
+    JsonDocument doc;
+    doc["lineOwner"] = uartLineOwnerName();
+    
+    // Sınıf başına kuyruk bekleme süreleri
+    for (int p = 0; p < UART_PRIO_COUNT; p++) {
+        const UARTQueueStats& q = uartQueueStats[p];
+        JsonObject cls = doc["queues"][uartPriorityName((UARTPriority)p)].to<JsonObject>();
+        cls["acquired"] = q.acquired;
+        cls["waiting"] = q.waiting;
+        cls["timeouts"] = q.timeouts;
+        cls["yields"] = q.yields;
+        cls["avgWaitMs"] = q.acquired > 0 ? (float)(q.totalWaitUs / q.acquired) / 1000.0 : 0.0;
+        cls["maxWaitMs"] = q.maxWaitUs / 1000.0;
+        cls["lastWaitMs"] = q.lastWaitUs / 1000.0;
+    }
+    
+    // İstemci ayrıldığı için bırakılan işler
+    doc["cancelled"]["droppedQueued"] = uartCancelStats.droppedQueued;
+    doc["cancelled"]["abortedBulk"] = uartCancelStats.abortedBulk;
+    
+    // UART worker'ına devredilen HTTP istekleri
+    DeferredStats deferredStats;
+    getDeferredStats(deferredStats);
+    doc["deferred"]["queued"] = deferredStats.queued;
+    doc["deferred"]["completed"] = deferredStats.completed;
+    doc["deferred"]["inline"] = deferredStats.inlineCompleted;
+    doc["deferred"]["rejected"] = deferredStats.rejected;
+    doc["deferred"]["abandoned"] = deferredStats.abandoned;
+    doc["deferred"]["pending"] = deferredStats.queued - deferredStats.completed - deferredStats.abandoned;
+    doc["deferred"]["maxQueueWaitMs"] = deferredStats.maxQueueWaitMs;
+    
+    // WebSocket konsolu
+    UARTConsoleStats uartConsoleStats;
+    getUARTConsoleStats(uartConsoleStats);
+    JsonObject console = doc["console"].to<JsonObject>();
+    console["active"] = uartConsoleStats.active;
+    console["connects"] = uartConsoleStats.connects;
+    console["rejected"] = uartConsoleStats.rejected;
+    console["evicted"] = uartConsoleStats.evicted;
+    console["disconnects"] = uartConsoleStats.disconnects;
+    console["commands"] = uartConsoleStats.commands;
+    console["framesSent"] = uartConsoleStats.framesSent;
+    console["framesDropped"] = uartConsoleStats.framesDropped;
+    
+    // Sürücü olaylarından hat kalitesi
+    JsonObject link = doc["link"].to<JsonObject>();
+    link["diagnosis"] = getUARTLinkDiagnosis();
+    link["totals"]["frameErrors"] = uartLinkTotals.frameErrors;
+    link["totals"]["parityErrors"] = uartLinkTotals.parityErrors;
+    link["totals"]["fifoOverflows"] = uartLinkTotals.fifoOverflows;
+    link["totals"]["bufferFull"] = uartLinkTotals.bufferFull;
+    link["totals"]["breaks"] = uartLinkTotals.breaks;
+    link["totals"]["timeouts"] = uartLinkTotals.timeouts;
+    link["totals"]["txBytes"] = uartLinkTotals.txBytes;
+    link["totals"]["rxBytes"] = uartLinkTotals.rxBytes;
+    link["resets"] = uartResetStats.resets;
+    link["resetsSuppressed"] = uartResetStats.suppressed;
+    
+    // 1 dakikalık pencereler, en yeni (süren) önce
+    UARTLinkWindow windows[UART_LINK_WINDOW_HISTORY + 1];
+    int windowCount = getUARTLinkWindows(windows, UART_LINK_WINDOW_HISTORY + 1);
+    JsonArray windowArray = link["windows"].to<JsonArray>();
+    for (int i = 0; i < windowCount; i++) {
+        const UARTLinkWindow& w = windows[i];
+        float seconds = w.durationMs > 0 ? w.durationMs / 1000.0 : 1.0;
+        JsonObject item = windowArray.add<JsonObject>();
+        item["current"] = (i == 0);
+        item["startedAgoS"] = (millis() - w.startedAt) / 1000;
+        item["durationS"] = w.durationMs / 1000;
+        item["txBytesPerSec"] = w.counters.txBytes / seconds;
+        item["rxBytesPerSec"] = w.counters.rxBytes / seconds;
+        item["frameErrors"] = w.counters.frameErrors;
+        item["parityErrors"] = w.counters.parityErrors;
+        item["fifoOverflows"] = w.counters.fifoOverflows;
+        item["bufferFull"] = w.counters.bufferFull;
+        item["breaks"] = w.counters.breaks;
+        item["timeouts"] = w.counters.timeouts;
+    }
+    
+    // Komutlar arası uyarlamalı boşluk
+    doc["pacer"]["gapMs"] = uartPacerStats.gapMs;
+    doc["pacer"]["avgLatencyMs"] = uartPacerStats.avgLatencyUs / 1000.0;
+    doc["pacer"]["lastLatencyMs"] = uartPacerStats.lastLatencyUs / 1000.0;
+    doc["pacer"]["successes"] = uartPacerStats.successes;
+    doc["pacer"]["errors"] = uartPacerStats.errors;
+    doc["pacer"]["slowResponses"] = uartPacerStats.slowResponses;
+    doc["pacer"]["backoffs"] = uartPacerStats.backoffs;
+    doc["pacer"]["waits"] = uartPacerStats.waits;
+    doc["pacer"]["totalWaitMs"] = uartPacerStats.totalWaitMs;
+    
+    // dsPIC değer önbelleği
+    for (int i = 0; i < DSPIC_CACHE_ITEMS; i++) {
+        DsPICCacheItem item = (DsPICCacheItem)i;
+        const DsPICCacheStats& c = dspicCacheStats[i];
+        JsonObject entry = doc["cache"][dspicCacheItemName(item)].to<JsonObject>();
+        entry["hits"] = c.hits;
+        entry["staleHits"] = c.staleHits;
+        entry["misses"] = c.misses;
+        entry["refreshes"] = c.refreshes;
+        entry["refreshFailures"] = c.refreshFailures;
+        entry["ageMs"] = dspicCacheAge(item);
+    }
+    
+    doc["stats"]["sent"] = uartStats.totalFramesSent;
+    doc["stats"]["received"] = uartStats.totalFramesReceived;
+    doc["stats"]["timeouts"] = uartStats.timeoutErrors;
+    doc["stats"]["successRate"] = uartStats.successRate;
     
     addSecurityHeaders();
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
+}
+
+static const char* httpMethodName(HTTPMethod method) {
+    switch (method) {
+        case HTTP_GET:    return "GET";
+        case HTTP_POST:   return "POST";
+        case HTTP_PUT:    return "PUT";
+        case HTTP_DELETE: return "DELETE";
+        case HTTP_ANY:    return "ANY";
+        default:          return "OTHER";
+    }
+}
+
+// Rota başına sayaçlar - yalnızca son sıfırlamadan beri istek almış yuvalar
+static void addEndpointMetrics(JsonDocument& doc) {
+    JsonObject endpoints = doc["endpoints"].to<JsonObject>();
+    endpoints["sinceMs"] = routeMetricsAge();
+    JsonArray bounds = endpoints["latencyBoundsMs"].to<JsonArray>();
+    for (int b = 0; b < ROUTE_LATENCY_BUCKETS - 1; b++) {
+        bounds.add(routeLatencyBoundsUs[b] / 1000);
+    }
+
+    JsonArray items = endpoints["routes"].to<JsonArray>();
+    RouteMetrics m;
+    for (size_t slot = 0; slot < server.routeSlotCount(); slot++) {
+        if (!getRouteMetrics(slot, m) || m.requests == 0) continue;
+
+        HTTPMethod method;
+        const char* path = server.routeSlotPath(slot, method);
+        JsonObject item = items.add<JsonObject>();
+        item["method"] = httpMethodName(method);
+        item["path"] = path;
+        item["requests"] = m.requests;
+        item["deferred"] = m.deferred;
+        JsonObject status = item["status"].to<JsonObject>();
+        status["2xx"] = m.statusClass[1];
+        status["3xx"] = m.statusClass[2];
+        status["4xx"] = m.statusClass[3];
+        status["5xx"] = m.statusClass[4];
+        item["bytes"] = m.bytesSent;
+        item["writes"] = m.writes;
+        item["writesPerResponse"] = (float)m.writes / m.requests;
+        item["avgUs"] = (uint32_t)(m.totalUs / m.requests);
+        item["maxUs"] = m.maxUs;
+        item["heapDeltaMin"] = m.minHeapDelta;
+        item["heapDeltaMax"] = m.maxHeapDelta;
+        JsonArray histogram = item["histogram"].to<JsonArray>();
+        for (int b = 0; b < ROUTE_LATENCY_BUCKETS; b++) {
+            histogram.add(m.histogram[b]);
+        }
+    }
+}
+
+// HTTP bağlantı yeniden kullanımı (keep-alive / pipelining) ve rota başına sayaçlar.
+// POST action=reset rota sayaçlarını sıfırlar (ör. firmware güncellemesinden sonra)
+void handleHttpMetricsAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+
+    if (server.method() == HTTP_POST) {
+        if (server.arg("action") != "reset") {
+            server.send(400, "application/json", "{\"error\":\"Invalid action. Use: reset\"}");
+            return;
+        }
+        resetRouteMetrics();
+        addLog("HTTP rota metrikleri sıfırlandı", INFO, "WEB");
+    }
+
+    const KeepAliveStats& ka = keepAliveStats;
+    JsonDocument doc;
+    JsonObject conn = doc["connections"].to<JsonObject>();
+    conn["idleTimeoutMs"] = server.keepAliveIdleTimeout();
+    conn["maxRequests"] = server.keepAliveMaxRequests();
+    conn["poolSize"] = KEEPALIVE_MAX_CONNECTIONS;
+    conn["open"] = ka.open;
+    conn["accepted"] = ka.connections;
+    conn["requests"] = ka.requests;
+    conn["reusedRequests"] = ka.reusedRequests;
+    conn["pipelined"] = ka.pipelined;
+    conn["reuseRate"] = ka.requests > 0 ? (float)ka.reusedRequests / ka.requests : 0.0;
+    conn["requestsPerConnection"] = ka.connections > 0 ? (float)ka.requests / ka.connections : 0.0;
+
+    JsonObject closed = conn["closed"].to<JsonObject>();
+    closed["idle"] = ka.closedIdle;
+    closed["maxRequests"] = ka.closedMaxRequests;
+    closed["client"] = ka.closedByClient;
+    closed["server"] = ka.closedByServer;
+    closed["evicted"] = ka.evicted;
+    closed["handedOff"] = ka.handedOff;
+
+    JsonObject assets = doc["static"].to<JsonObject>();
+    assets["embeddedAssets"] = embeddedAssetCount();
+    assets["indexed"] = staticAssetCount();
+    assets["embedded"] = staticAssetStats.embedded;
+    assets["served"] = staticAssetStats.served;
+    assets["notModified"] = staticAssetStats.notModified;
+    assets["unindexed"] = staticAssetStats.unindexed;
+
+    JsonObject ranges = assets["ranges"].to<JsonObject>();
+    ranges["partial"] = rangeStats.partial;
+    ranges["partialBytes"] = rangeStats.partialBytes;
+    ranges["unsatisfiable"] = rangeStats.unsatisfiable;
+    ranges["ifRangeMismatch"] = rangeStats.ifRangeMismatch;
+
+    JsonObject sse = doc["events"].to<JsonObject>();
+    sse["clients"] = eventStreamClientCount();
+    sse["connects"] = eventStreamStats.connects;
+    sse["rejected"] = eventStreamStats.rejected;
+    sse["evicted"] = eventStreamStats.evicted;
+    sse["dropped"] = eventStreamStats.dropped;
+    sse["events"] = eventStreamStats.events;
+    sse["heartbeats"] = eventStreamStats.heartbeats;
+    sse["replayedLogs"] = eventStreamStats.replayedLogs;
+
+    JsonObject json = doc["json"].to<JsonObject>();
+    json["bufferBytes"] = JSON_STREAM_BUFFER;
+    json["single"] = jsonStreamStats.single;
+    json["chunked"] = jsonStreamStats.chunked;
+    json["chunks"] = jsonStreamStats.chunks;
+    json["maxBytes"] = jsonStreamStats.maxBytes;
+
+    // Tampona sığmayan yanıtların gzip'i: oran = çıktı / girdi, CPU süresi kodlayıcıda
+    JsonObject gzip = json["gzip"].to<JsonObject>();
+    uint32_t cpuMhz = ESP.getCpuFreqMHz();
+    gzip["responses"] = gzipStats.responses;
+    gzip["skipped"] = gzipStats.skipped;
+    gzip["inBytes"] = gzipStats.inBytes;
+    gzip["outBytes"] = gzipStats.outBytes;
+    gzip["ratio"] = gzipStats.inBytes > 0 ? (float)gzipStats.outBytes / gzipStats.inBytes : 0;
+    gzip["cpuUs"] = gzipStats.cycles / cpuMhz;
+    gzip["maxCpuUs"] = gzipStats.maxCycles / cpuMhz;
+    gzip["usPerKB"] = gzipStats.inBytes > 0 ? (uint32_t)(gzipStats.cycles / cpuMhz * 1024 / gzipStats.inBytes) : 0;
+
+    // Heap'e duyarlı kabul kontrolü
+    JsonObject admission = doc["admission"].to<JsonObject>();
+    admission["largestBlock"] = ESP.getMaxAllocHeap();
+    admission["minLargestBlock"] = admissionStats.minLargestBlock;
+    admission["reserveBytes"] = ADMISSION_RESERVE_BYTES;
+    admission["degradeBelow"] = ADMISSION_DEGRADE_BYTES;
+    admission["degraded"] = admissionDegraded();
+    admission["shedding"] = admissionShedding();
+    admission["admitted"] = admissionStats.admitted;
+    admission["rejected"] = admissionStats.rejected;
+    admission["reservedAdmitted"] = admissionStats.reservedAdmitted;
+    admission["degradedAdmitted"] = admissionStats.degraded;
+    admission["sheddingEpisodes"] = admissionStats.sheddingEpisodes;
+
+    // Oturum tablosu
+    JsonObject sessions = doc["sessions"].to<JsonObject>();
+    sessions["active"] = activeSessionCount();
+    sessions["capacity"] = SESSION_TABLE_SIZE;
+    sessions["created"] = sessionStats.created;
+    sessions["evicted"] = sessionStats.evicted;
+    sessions["expired"] = sessionStats.expired;
+    sessions["revoked"] = sessionStats.revoked;
+    sessions["rejected"] = sessionStats.rejected;
+
+    // İstemci başına rate limit (sınıf başına izin verilen / 429)
+    JsonObject rate = doc["rateLimit"].to<JsonObject>();
+    rate["clients"] = rateLimitStats.tracked;
+    rate["tableSize"] = RATE_LIMIT_TABLE_SIZE;
+    rate["evicted"] = rateLimitStats.evicted;
+    for (int k = 0; k < RATE_CLASS_COUNT; k++) {
+        JsonObject cls = rate[rateClassName((RateClass)k)].to<JsonObject>();
+        cls["burst"] = rateClassConfig[k].burst;
+        cls["perSecond"] = rateClassConfig[k].perSecond;
+        cls["allowed"] = rateLimitStats.allowed[k];
+        cls["rejected"] = rateLimitStats.rejected[k];
+    }
+
+    // Serileştirilmiş yanıt önbelleği (isabet / yeniden üretim)
+    for (int i = 0; i < RESPONSE_CACHE_ITEMS; i++) {
+        ResponseCacheItem item = (ResponseCacheItem)i;
+        JsonObject cached = doc["responseCache"][responseCacheItemName(item)].to<JsonObject>();
+        cached["ttl"] = responseCacheTTL(item);
+        cached["age"] = responseCacheAge(item);
+        cached["bytes"] = responseCacheHasValue(item) ? responseCacheStats[i].bytes : 0;
+        cached["hits"] = responseCacheStats[i].hits;
+        cached["misses"] = responseCacheStats[i].misses;
+        cached["invalidations"] = responseCacheStats[i].invalidations;
+    }
+
+    // Sürüm sayaçlı API yanıtları (304 / 200)
+    for (int d = 0; d < STATE_DOMAIN_COUNT; d++) {
+        JsonObject domain = doc["conditional"][stateDomainName((StateDomain)d)].to<JsonObject>();
+        domain["version"] = getStateVersion((StateDomain)d);
+        domain["notModified"] = stateVersionStats[d].notModified;
+        domain["full"] = stateVersionStats[d].full;
+    }
+
+    addEndpointMetrics(doc);
+
+    server.sendJson(200, doc);
+}
+
+// Rota tablosu metrikleri - GET /api/metrics/routes[?bench=<tur>]
+// bench verilirse tüm rotalar özetli ve doğrusal aramayla ölçülür (tools/route_bench.py)
+#define ROUTE_BENCH_MAX_ROUNDS 1000
+
+void handleRouteMetricsAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+
+    JsonDocument doc;
+    doc["routes"] = routeStats.routes;
+    doc["indexSlots"] = ROUTE_INDEX_SLOTS;
+    doc["maxProbe"] = routeStats.maxProbe;
+    doc["duplicates"] = routeStats.duplicates;
+    doc["exact"] = routeStats.exact;
+    doc["prefixed"] = routeStats.prefixed;
+    doc["rejected"] = routeStats.rejected;
+    doc["fallback"] = routeStats.fallback;
+    doc["limited"] = routeStats.limited;
+
+    unsigned long lookups = routeStats.exact + routeStats.prefixed + routeStats.fallback;
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    doc["lookupAvgNs"] = lookups > 0 ? (uint32_t)(routeStats.totalCycles * 1000 / mhz / lookups) : 0;
+    doc["lookupMaxNs"] = routeStats.maxCycles * 1000 / mhz;
+
+    if (server.hasArg("bench")) {
+        long rounds = server.arg("bench").toInt();
+        if (rounds < 1) rounds = 1;
+        if (rounds > ROUTE_BENCH_MAX_ROUNDS) rounds = ROUTE_BENCH_MAX_ROUNDS;
+        RouteBenchResult bench = server.benchmarkRoutes(rounds);
+        JsonObject b = doc["bench"].to<JsonObject>();
+        b["rounds"] = bench.rounds;
+        b["routes"] = bench.routes;
+        b["cpuMhz"] = mhz;
+        b["hashedAvgCycles"] = bench.hashedAvgCycles;
+        b["linearAvgCycles"] = bench.linearAvgCycles;
+        b["linearWorstCycles"] = bench.linearWorstCycles;
+    }
+
+    server.sendJson(200, doc);
+}
+
+// UART trafik kaydı - GET durum, POST action=start|stop|clear
+void handleUARTCaptureAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+    
+    if (server.method() == HTTP_POST) {
+        String action = server.arg("action");
+        if (action == "start") {
+            if (!startUARTCapture()) {
+                server.send(500, "application/json", "{\"success\":false,\"error\":\"Kayıt tamponu ayrılamadı\"}");
+                return;
+            }
+        } else if (action == "stop") {
+            stopUARTCapture();
+        } else if (action == "clear") {
+            clearUARTCapture();
+        } else {
+            server.send(400, "application/json", "{\"error\":\"Invalid action. Use: start, stop, or clear\"}");
+            return;
+        }
+    }
+    
+    JsonDocument doc;
+    doc["enabled"] = (bool)uartCaptureEnabled;
+    doc["inPsram"] = uartCaptureStats.inPsram;
+    doc["capacity"] = uartCaptureStats.capacity;
+    doc["usedBytes"] = uartCaptureStats.usedBytes;
+    doc["records"] = uartCaptureStats.records;
+    doc["dropped"] = uartCaptureStats.dropped;
+    doc["truncated"] = uartCaptureStats.truncated;
+    doc["overhead"]["avgNs"] = uartCaptureAvgOverheadNs();
+    doc["overhead"]["maxNs"] = uartCaptureMaxOverheadNs();
+    doc["overhead"]["samples"] = uartCaptureStats.recordCalls;
+    
+    addSecurityHeaders();
+    server.sendJson(200, doc);
+}
+
+static size_t readCaptureContent(void* context, size_t offset, uint8_t* buffer, size_t length) {
+    return uartCaptureExportRead(offset, buffer, length);
+}
+
+// UART kaydını ikili dosya olarak indir - GET /api/uart/capture/download
+void handleUARTCaptureDownload() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+    
+    // Okuma sırasında halka değişmesin; kayıt indirme bitince devam eder
+    uartCapturePause();
+    
+    size_t total = uartCaptureExportSize();
+    String etag = uartCaptureExportTag();
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Content-Disposition", "attachment; filename=\"uart_capture.bin\"");
+    // Kopan indirme If-Range ile devam eder; Range: bytes=-N yalnızca son kayıtları alır
+    if (sendRange("application/octet-stream", total, etag, NULL, readCaptureContent, NULL)) {
+        uartCaptureResume();
+        return;
+    }
+    server.setContentLength(total);
+    server.send(200, "application/octet-stream", "");
+    
+    uint8_t chunk[512];
+    size_t offset = 0;
+    while (offset < total) {
+        size_t n = uartCaptureExportRead(offset, chunk, sizeof(chunk));
+        if (n == 0) break;
+        server.sendContent((const char*)chunk, n);
+        offset += n;
+    }
+    
+    uartCaptureResume();
 }
 
 void handleGetNtpAPI() {
     if (!checkSession()) { server.send(401); return; }
+    if (stateNotModified(STATE_NTP)) return;
     JsonDocument doc;
     doc["ntpServer1"] = ntpConfig.ntpServer1;
     doc["ntpServer2"] = ntpConfig.ntpServer2;
-    String output;
-    serializeJson(doc, output);
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 void handlePostNtpAPI() {
@@ -810,9 +1491,7 @@ void handleGetBaudRateAPI() {
     if (!checkSession()) { server.send(401); return; }
     JsonDocument doc;
     doc["baudRate"] = settings.currentBaudRate;
-    String output;
-    serializeJson(doc, output);
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 void handlePostBaudRateAPI() {
@@ -826,6 +1505,7 @@ void handlePostBaudRateAPI() {
 
 void handleGetLogsAPI() {
     if (!checkSession()) { server.send(401); return; }
+    if (stateNotModified(STATE_LOGS)) return;
     
     JsonDocument doc;
     JsonArray logArray = doc.to<JsonArray>();
@@ -833,6 +1513,7 @@ void handleGetLogsAPI() {
     extern LogEntry logs[50];
     extern int totalLogs;
     
+    lockLogs();
     for (int i = 0; i < totalLogs; i++) {
         // Logları en yeniden en eskiye doğru sıralamak için indeksi düzeltelim
         int idx = (logIndex - 1 - i + 50) % 50;
@@ -844,24 +1525,15 @@ void handleGetLogsAPI() {
         logEntry["l"] = logLevelToString(logs[idx].level);
         logEntry["s"] = logs[idx].source;
     }
+    unlockLogs();
     
-    String output;
-    serializeJson(doc, output);
-    server.send(200, "application/json", output);
+    server.sendJson(200, doc);
 }
 
 // Password change sayfası için token kontrolü (ama atmaz)
 void handlePasswordChangeCheck() {
-    String token = "";
-    if (server.hasHeader("Authorization")) {
-        String authHeader = server.header("Authorization");
-        if (authHeader.startsWith("Bearer ")) {
-            token = authHeader.substring(7);
-        }
-    }
-    
     // Token yoksa veya geçersizse sadece uyarı döndür
-    if (token.length() == 0 || settings.sessionToken.length() == 0 || token != settings.sessionToken) {
+    if (!isTokenValid(requestToken())) {
         server.send(200, "application/json", "{\"validSession\":false,\"message\":\"Oturum geçersiz ama devam edebilirsiniz\"}");
     } else {
         server.send(200, "application/json", "{\"validSession\":true}");
@@ -874,121 +1546,223 @@ void handleClearLogsAPI() {
     server.send(200, "text/plain", "OK");
 }
 
-void setupWebRoutes() {
+// /pages/ altındaki SPA parçaları - oturum kontrolü önek kuralında
+static void servePageFragment() {
+    String path = server.uri();
+    if (!path.endsWith(".html") || path.indexOf("..") >= 0) {
+        server.send(404, "text/plain", "404: Not Found");
+        return;
+    }
+    serveStaticFile(path, "text/html");
+}
+
+// /js/ altındaki sayfa modülleri - loadPage() ilk ziyarette yükler. script.js gibi
+// oturumsuz sunulur (<script> etiketi Authorization başlığı gönderemez)
+static void servePageModule() {
+    String path = server.uri();
+    if (!path.endsWith(".js") || path.indexOf("..") >= 0) {
+        server.send(404, "text/plain", "404: Not Found");
+        return;
+    }
+    serveStaticFile(path, "application/javascript");
+}
+
+// Fault komutları için debug endpoint'i
+static void handleUARTSendAPI() {
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+    
+    String command = server.arg("command");
+    if (command.length() == 0) {
+        server.send(400, "application/json", "{\"error\":\"Command parameter required\"}");
+        return;
+    }
     
-    server.on("/favicon.ico", HTTP_GET, []() { server.send(204); });
+    server.deferRequest(finishUARTSend, REQUEST_UART_BUDGET);
+}
+
+// Birden çok GET okumasını tek istekte yanıtlar: GET /api/batch?paths=/api/status,/api/ntp
+// Oturum bir kez doğrulanır; yalnızca ROUTE_BATCH ile işaretli rotalar çalıştırılır.
+// Yolun kendi query'si olabilir (URL kodlu: /api/logs%3Flimit%3D10); alt istek yalnızca onu görür.
+// Yanıt: {"results":{"<yol>":{"status":200,"data":<gövde>}},"count":N}
+static void handleBatchAPI() {
+    addSecurityHeaders();
+    if (!checkSession()) {
+        server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+        return;
+    }
+
+    String paths = server.arg("paths");
+    if (paths.length() == 0) {
+        server.send(400, "application/json", "{\"error\":\"paths parameter required\"}");
+        return;
+    }
+
+    JsonDocument doc;
+    JsonObject results = doc["results"].to<JsonObject>();
+    CapturedResponse captured;
+    size_t totalBytes = 0;
+    int count = 0;
+    int start = 0;
+
+    while (start < (int)paths.length()) {
+        int comma = paths.indexOf(',', start);
+        if (comma < 0) comma = paths.length();
+        String path = paths.substring(start, comma);
+        path.trim();
+        start = comma + 1;
+        if (path.length() == 0) continue;
+
+        JsonObject item = results[path].to<JsonObject>();
+        String query;
+        int question = path.indexOf('?');
+        if (question >= 0) {
+            query = path.substring(question + 1);
+            path = path.substring(0, question);
+        }
+        if (++count > BATCH_MAX_PATHS) {
+            item["status"] = 413;
+            item["error"] = "En fazla " + String(BATCH_MAX_PATHS) + " yol";
+            continue;
+        }
+        const Route* route = server.findRoute(HTTP_GET, path.c_str());
+        if (route == NULL || !(route->flags & ROUTE_FLAG_BATCH)) {
+            item["status"] = 404;
+            item["error"] = "Toplu istekte kullanılamaz";
+            continue;
+        }
+        size_t maxBytes = admissionDegraded() ? BATCH_MAX_BYTES / 4 : BATCH_MAX_BYTES;
+        if (totalBytes >= maxBytes) {
+            item["status"] = 507;
+            item["error"] = "Toplu yanıt sınırı aşıldı";
+            continue;
+        }
+
+        // Kalan paydan büyük gövde yakalanırken bırakılır; yalnızca hata girdisi kalır
+        captured.limit = maxBytes - totalBytes;
+        server.markAuthenticated();   // Oturum yukarıda doğrulandı
+        server.runCaptured(*route, query, captured);
+        if (captured.truncated) {
+            item["status"] = 507;
+            item["error"] = "Yanıt toplu sınırı aşıyor";
+            continue;
+        }
+        item["status"] = captured.status;
+        if (captured.body.length() > 0) {
+            if (captured.json) {
+                item["data"] = serialized(captured.body);
+            } else {
+                item["data"] = captured.body;
+            }
+        }
+        totalBytes += captured.body.length();
+    }
+
+    doc["count"] = count;
+    addSecurityHeaders();   // runCaptured bekleyen başlıkları alt isteklerle birlikte temizler
+    server.sendJson(200, doc);
+}
+
+// Rota tablosu: anahtarlar derleme zamanında hesaplanır (bkz. route_table.h).
+// Sınıf, istemci başına hangi rate limit kovasının kullanılacağını belirler.
+// ROUTE_BATCH rotaları /api/batch ile tek istekte birlikte okunabilir.
+// Heap tahmini (KB) kabul kontrolünde kullanılır; ROUTE_SHELL ve ROUTE_FLAG_RESERVED rotalar
+// (giriş, panel kabuğu, durum) bellek sıkışıkken de yedek paydan kabul edilir (bkz. admission.h).
+static const Route routeTable[] = {
+    ROUTE_STATIC(HTTP_GET, "/favicon.ico", []() { server.send(204); }),
     
     // ANA SAYFALAR (Oturum kontrolü yok, JS halledecek)
-    server.on("/", HTTP_GET, []() { serveStaticFile("/index.html", "text/html"); });
-    server.on("/login.html", HTTP_GET, []() { serveStaticFile("/login.html", "text/html"); });
-    server.on("/password_change.html", HTTP_GET, []() { serveStaticFile("/password_change.html", "text/html"); });
+    ROUTE_SHELL(HTTP_GET, "/", []() { serveStaticFile("/index.html", "text/html"); }),
+    ROUTE_SHELL(HTTP_GET, "/login.html", []() { serveStaticFile("/login.html", "text/html"); }),
+    ROUTE_STATIC(HTTP_GET, "/password_change.html", []() { serveStaticFile("/password_change.html", "text/html"); }),
     
     // STATİK DOSYALAR
-    server.on("/style.css", HTTP_GET, []() { serveStaticFile("/style.css", "text/css"); });
-    server.on("/script.js", HTTP_GET, []() { serveStaticFile("/script.js", "application/javascript"); });
-    server.on("/login.js", HTTP_GET, []() { serveStaticFile("/login.js", "application/javascript"); });
-
-    // SPA SAYFA PARÇALARI (Oturum kontrolü GEREKLİ)
-    server.on("/pages/dashboard.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/dashboard.html", "text/html"); else server.send(401); });
-    server.on("/pages/network.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/network.html", "text/html"); else server.send(401); });
-    server.on("/pages/systeminfo.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/systeminfo.html", "text/html"); else server.send(401); });
-    server.on("/pages/ntp.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/ntp.html", "text/html"); else server.send(401); });
-    server.on("/pages/baudrate.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/baudrate.html", "text/html"); else server.send(401); });
-    server.on("/pages/fault.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/fault.html", "text/html"); else server.send(401); });
-    server.on("/pages/log.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/log.html", "text/html"); else server.send(401); });
-    server.on("/pages/datetime.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/datetime.html", "text/html"); else server.send(401); });
-    server.on("/pages/account.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/account.html", "text/html"); else server.send(401); });
-    server.on("/pages/backup.html", HTTP_GET, []() { if(checkSession()) serveStaticFile("/pages/backup.html", "text/html"); else server.send(401); });
+    ROUTE_SHELL(HTTP_GET, "/style.css", []() { serveStaticFile("/style.css", "text/css"); }),
+    ROUTE_SHELL(HTTP_GET, "/script.js", []() { serveStaticFile("/script.js", "application/javascript"); }),
+    ROUTE_SHELL(HTTP_GET, "/login.js", []() { serveStaticFile("/login.js", "application/javascript"); }),
+
+    // Gösterge paneli: önek kurallarından önce eşleşir, bellek sıkışıkken de açılır
+    ROUTE_SHELL(HTTP_GET, "/pages/dashboard.html", []() {
+        if (!checkSession()) { server.send(401); return; }
+        serveStaticFile("/pages/dashboard.html", "text/html");
+    }),
+    ROUTE_SHELL(HTTP_GET, "/js/dashboard.js", []() { serveStaticFile("/js/dashboard.js", "application/javascript"); }),
 
     // KİMLİK DOĞRULAMA
-    server.on("/login", HTTP_POST, handleUserLogin);
-    server.on("/logout", HTTP_GET, handleUserLogout);
+    ROUTE_ENTRY(RATE_API, ROUTE_FLAG_RESERVED, ROUTE_HEAP_API_KB, HTTP_POST, "/login", handleUserLogin),
+    ROUTE(HTTP_GET, "/logout", handleUserLogout),
 
     // API ENDPOINT'LERİ
+    ROUTE_HEAVY(16, HTTP_GET, "/api/batch", handleBatchAPI),          // BATCH_MAX_BYTES + belge
+    ROUTE_BATCH(HTTP_GET, "/api/device-info", handleDeviceInfoAPI),      // Auth gerekmez
+    ROUTE_BATCH(HTTP_GET, "/api/system-info", handleSystemInfoAPI),
+    ROUTE_BATCH(HTTP_GET, "/api/network", handleGetNetworkAPI),
+    ROUTE(HTTP_POST, "/api/network", handlePostNetworkAPI),
+    ROUTE_BATCH(HTTP_GET, "/api/notifications", handleNotificationAPI),
+    ROUTE(HTTP_GET, "/api/events", handleEventStream),
+    ROUTE(HTTP_POST, "/api/system/reboot", handleSystemRebootAPI),
 
-    // Device Info (Auth gerekmez)
-    server.on("/api/device-info", HTTP_GET, handleDeviceInfoAPI);
+    ROUTE_ENTRY(RATE_API, ROUTE_FLAG_BATCH | ROUTE_FLAG_RESERVED, ROUTE_HEAP_API_KB,
+                HTTP_GET, "/api/status", handleStatusAPI),
+    ROUTE_BATCH(HTTP_GET, "/api/settings", handleGetSettingsAPI),
+    ROUTE(HTTP_POST, "/api/settings", handlePostSettingsAPI),
+    ROUTE_BATCH(HTTP_GET, "/api/ntp", handleGetNtpAPI),
+    ROUTE(HTTP_POST, "/api/ntp", handlePostNtpAPI),
+    ROUTE_BATCH(HTTP_GET, "/api/baudrate", handleGetBaudRateAPI),
+    ROUTE_UART(HTTP_POST, "/api/baudrate", handlePostBaudRateAPI),
+    ROUTE_ENTRY(RATE_API, ROUTE_FLAG_BATCH, 8, HTTP_GET, "/api/logs", handleGetLogsAPI),   // 50 kayıt
+    ROUTE(HTTP_POST, "/api/logs/clear", handleClearLogsAPI),
     
-    // System Info (Auth gerekli)
-    server.on("/api/system-info", HTTP_GET, handleSystemInfoAPI);
+    // DateTime API endpoints
+    ROUTE_BATCH(HTTP_GET, "/api/datetime", handleGetDateTimeAPI),
+    ROUTE_UART(HTTP_POST, "/api/datetime/fetch", handleFetchDateTimeAPI),
+    ROUTE_UART(HTTP_POST, "/api/datetime/set", handleSetDateTimeAPI),
+    ROUTE_UART(HTTP_POST, "/api/datetime/sync-esp32", handleSyncESP32API),
+    ROUTE_UART(HTTP_POST, "/api/datetime/set-current", handleSetCurrentTimeAPI),
+    ROUTE(HTTP_GET, "/api/datetime/history", handleDateTimeHistoryAPI),
+    ROUTE(HTTP_POST, "/api/datetime/preview", handleDateTimePreviewAPI),
+    
+    // UART
+    ROUTE_UART(HTTP_GET, "/api/uart/test", handleUARTTestAPI),
+    ROUTE_UART(HTTP_POST, "/api/uart/send", handleUARTSendAPI),
+    ROUTE(HTTP_GET, "/api/uart/metrics", handleUARTMetricsAPI),
+    ROUTE(HTTP_GET, "/api/uart/capture", handleUARTCaptureAPI),
+    ROUTE(HTTP_POST, "/api/uart/capture", handleUARTCaptureAPI),
+    ROUTE(HTTP_GET, "/api/uart/capture/download", handleUARTCaptureDownload),
+    ROUTE_UART(HTTP_GET, "/api/uart/console", handleUARTConsole),
+    ROUTE_HEAVY(12, HTTP_GET, "/api/metrics/http", handleHttpMetricsAPI),
+    ROUTE_HEAVY(12, HTTP_POST, "/api/metrics/http", handleHttpMetricsAPI),
+    ROUTE(HTTP_GET, "/api/metrics/routes", handleRouteMetricsAPI),
 
-    // Network Configuration
-    server.on("/api/network", HTTP_GET, handleGetNetworkAPI);
-    server.on("/api/network", HTTP_POST, handlePostNetworkAPI);
+    // Arıza API'leri
+    ROUTE_UART(HTTP_GET, "/api/faults/count", handleGetFaultCountAPI),
+    ROUTE_UART(HTTP_POST, "/api/faults/get", handleGetSpecificFaultAPI),
+    ROUTE_ENTRY(RATE_UART, 0, 10, HTTP_POST, "/api/faults/parsed", handleParsedFaultAPI),   // range: 20 kayıt
 
-    // Notifications
-    server.on("/api/notifications", HTTP_GET, handleNotificationAPI);
-    
-    // System Reboot
-    server.on("/api/system/reboot", HTTP_POST, handleSystemRebootAPI);
+    ROUTE_HEAVY(8, HTTP_GET, "/api/backup/download", handleBackupDownload),     // Pretty JSON String
+    ROUTE(HTTP_POST, "/api/change-password", handlePasswordChangeAPI),
+    // Password Change Check (soft check)
+    ROUTE(HTTP_GET, "/api/check-password-session", handlePasswordChangeCheck),
+};
 
-    server.on("/api/status", HTTP_GET, handleStatusAPI);
-    server.on("/api/settings", HTTP_GET, handleGetSettingsAPI);
-    server.on("/api/settings", HTTP_POST, handlePostSettingsAPI);
-    server.on("/api/ntp", HTTP_GET, handleGetNtpAPI);
-    server.on("/api/ntp", HTTP_POST, handlePostNtpAPI);
-    server.on("/api/baudrate", HTTP_GET, handleGetBaudRateAPI);
-    server.on("/api/baudrate", HTTP_POST, handlePostBaudRateAPI);
-    server.on("/api/logs", HTTP_GET, handleGetLogsAPI);
-    server.on("/api/logs/clear", HTTP_POST, handleClearLogsAPI);
-    // DateTime API endpoints
-    server.on("/api/datetime", HTTP_GET, handleGetDateTimeAPI);
-    server.on("/api/datetime/fetch", HTTP_POST, handleFetchDateTimeAPI);
-    server.on("/api/datetime/set", HTTP_POST, handleSetDateTimeAPI);
-    server.on("/api/datetime/sync-esp32", HTTP_POST, handleSyncESP32API);
-    server.on("/api/datetime/set-current", HTTP_POST, handleSetCurrentTimeAPI);
-    server.on("/api/datetime/history", HTTP_GET, handleDateTimeHistoryAPI);
-    server.on("/api/datetime/preview", HTTP_POST, handleDateTimePreviewAPI);
-    // ✅ UART Test API'si ekle
-    server.on("/api/uart/test", HTTP_GET, handleUARTTestAPI);
-
-    // YENİ route'ları EKLE:
-    server.on("/api/faults/count", HTTP_GET, handleGetFaultCountAPI);
-    server.on("/api/faults/get", HTTP_POST, handleGetSpecificFaultAPI);
-    server.on("/api/faults/parsed", HTTP_POST, handleParsedFaultAPI); // Güncellendi
-
-     // ✅ Fault komutları için debug endpoint'leri
-    server.on("/api/uart/send", HTTP_POST, []() {
-        if (!checkSession()) {
-            server.send(401, "application/json", "{\"error\":\"Unauthorized\"}");
-            return;
-        }
-        
-        String command = server.arg("command");
-        if (command.length() == 0) {
-            server.send(400, "application/json", "{\"error\":\"Command parameter required\"}");
-            return;
-        }
-        
-        addLog("🧪 Manuel komut gönderiliyor: " + command, INFO, "UART");
-        
-        String response;
-        bool success = sendCustomCommand(command, response, 3000);
-        
-        JsonDocument doc;
-        doc["command"] = command;
-        doc["success"] = success;
-        doc["response"] = response;
-        doc["responseLength"] = response.length();
-        doc["timestamp"] = getFormattedTimestamp();
-        
-        String output;
-        serializeJson(doc, output);
-        
-        server.send(200, "application/json", output);
-    });
+// SPA SAYFA PARÇALARI (Oturum kontrolü GEREKLİ) ve sayfa modülleri
+static const RoutePrefix prefixTable[] = {
+    {HTTP_GET, "/pages/", checkSession, servePageFragment, RATE_STATIC},
+    {HTTP_GET, "/js/", NULL, servePageModule, RATE_STATIC},
+};
 
-    
-    server.on("/api/backup/download", HTTP_GET, handleBackupDownload);
-    // Yedek yükleme için doğru handler tanımı
+void setupWebRoutes() {
+    server.setRoutes(routeTable, sizeof(routeTable) / sizeof(routeTable[0]),
+                     prefixTable, sizeof(prefixTable) / sizeof(prefixTable[0]));
+
+    // Dosya yükleme WebServer'ın kendi listesinde kalır: yükleme gövdesi istek
+    // ayrıştırılırken handler'a akar
     server.on("/api/backup/upload", HTTP_POST, 
         []() { server.send(200, "text/plain", "OK"); }, // Önce bir OK yanıtı gönderilir
         handleBackupUpload // Sonra dosya yükleme işlenir
     );
-    server.on("/api/change-password", HTTP_POST, handlePasswordChangeAPI);
-
-    // Password Change Check (soft check)
-    server.on("/api/check-password-session", HTTP_GET, handlePasswordChangeCheck);
     
     // Her response'ta security headers ekle
     server.onNotFound([]() {
@@ -998,5 +1772,5 @@ void setupWebRoutes() {
     });
     
     server.begin();
-    addLog("✅ Web sunucu başlatıldı", SUCCESS, "WEB");
+    addLog("✅ Web sunucu başlatıldı (" + String(routeStats.routes) + " rota)", SUCCESS, "WEB");
 }
\ No newline at end of file
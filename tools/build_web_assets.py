@@ -0,0 +1,341 @@
+#!/usr/bin/env python3
+"""data/ altındaki web dosyalarını küçültür, gzip'ler ve manifest yazar.
+
+PlatformIO'da `extra_scripts = pre:tools/build_web_assets.py` olarak çalışır:
+çıktı .pio/build/<env>/www altına yazılır ve LittleFS imajı (buildfs/uploadfs)
+data/ yerine bu dizinden oluşturulur. İmajda yalnızca `<yol>.gz` dosyaları ve
+`/manifest.json` bulunur; sunucu ETag ve Cache-Control değerlerini buradan alır.
+
+Aynı gzip'li içerik derleme dizinindeki generated/web_assets_data.h dosyasına
+constexpr bayt dizileri olarak da yazılır ve firmware'e gömülür. Sunucu gömülü
+kopyayı flash'tan doğrudan gönderir (dosya sistemi erişimi yok); arayüz
+firmware ile birlikte sürümlenir. LittleFS kopyası yalnızca yedektir.
+
+HTML içindeki script.js / style.css / login.js referanslarına `?v=<hash>` eklenir;
+sürümlü URL'ler tarayıcıda süresiz önbelleklenir, HTML her seferinde ETag ile
+doğrulanır (304).
+
+script.js yalnızca kabuktur (oturum, router, olay akışı); sayfa kodu data/js/<sayfa>.js
+modüllerindedir ve loadPage() ilk ziyarette yükler. Modül sürümleri script.js içindeki
+`{/*@module-versions*/}` işaretinin yerine yazılır, böylece modüller de `?v=` ile
+süresiz önbelleklenir ve bir modül değişince kabuğun sürümü de değişir.
+
+Elle çalıştırma:
+    python3 tools/build_web_assets.py [--src data] [--out .pio/www] [--header FILE]
+"""
+
+import argparse
+import gzip
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+MANIFEST_NAME = "manifest.json"
+HEADER_NAME = "web_assets_data.h"
+ETAG_HEX_LEN = 16      # ETag: içerik SHA-256'sının ilk 16 hanesi
+VERSION_HEX_LEN = 8    # ?v= parametresi
+TEXT_TYPES = (".html", ".js", ".css")
+VERSIONED_TYPES = (".js", ".css")
+PAGE_MODULE_DIR = "js/"                       # Sayfa modülleri (istek üzerine yüklenir)
+SHELL_SCRIPT = "script.js"
+MODULE_VERSIONS_MARKER = "{/*@module-versions*/}"
+
+# Regex literal'den önce gelebilecek karakterler (aksi halde '/' bölmedir)
+REGEX_PRECEDERS = set("(,=:[!&|?{};+-*%<>~^")
+REGEX_KEYWORDS = ("return", "typeof", "case", "do", "else", "in", "of")
+
+
+def _regex_allowed(line, pos):
+    before = line[:pos].rstrip()
+    if not before:
+        return True
+    if before[-1] in REGEX_PRECEDERS:
+        return True
+    return any(before.endswith(k) and (len(before) == len(k) or not before[-len(k) - 1].isalnum())
+               for k in REGEX_KEYWORDS)
+
+
+def _scan_js_line(line, state):
+    """Satırı tarar ve satır sonundaki durumu döndürür.
+
+    Durumlar: None (kod), '`' (template literal), 'block' (/* */ yorum).
+    ' ve " dizgileri ile regex literal'ler satır içinde kapanır.
+    """
+    i = 0
+    n = len(line)
+    while i < n:
+        c = line[i]
+        if state == "`":
+            if c == "\\":
+                i += 2
+                continue
+            if c == "`":
+                state = None
+        elif state == "block":
+            if line.startswith("*/", i):
+                state = None
+                i += 1
+        elif c in "'\"":
+            i += 1
+            while i < n and line[i] != c:
+                i += 2 if line[i] == "\\" else 1
+        elif c == "`":
+            state = "`"
+        elif line.startswith("//", i):
+            break
+        elif line.startswith("/*", i):
+            state = "block"
+            i += 1
+        elif c == "/" and _regex_allowed(line, i):
+            i += 1
+            in_class = False
+            while i < n:
+                ch = line[i]
+                if ch == "\\":
+                    i += 1
+                elif ch == "[":
+                    in_class = True
+                elif ch == "]":
+                    in_class = False
+                elif ch == "/" and not in_class:
+                    break
+                i += 1
+        i += 1
+    return state
+
+
+def minify_js(src):
+    """Girinti, satır sonu boşlukları, boş satırlar ve tam satır // yorumları atılır.
+
+    Satır sonları korunur (ASI davranışı değişmez); template literal ve blok yorum
+    içindeki satırlara dokunulmaz.
+    """
+    out = []
+    state = None
+    for line in src.split("\n"):
+        start = state
+        state = _scan_js_line(line, state)
+        if start is not None:
+            out.append(line.rstrip("\r"))
+            continue
+        stripped = line.strip()
+        if not stripped or stripped.startswith("//"):
+            continue
+        out.append(stripped if state is None else line.lstrip())
+    return "\n".join(out) + "\n"
+
+
+def minify_css(src):
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    src = re.sub(r"\s+", " ", src)
+    src = re.sub(r"\s*([{};,])\s*", r"\1", src)
+    return src.replace(";}", "}").strip() + "\n"
+
+
+RAW_BLOCK = re.compile(r"(<(script|style|pre|textarea)\b[^>]*>)(.*?)(</\2\s*>)", re.S | re.I)
+
+
+def minify_html(src):
+    parts = []
+    pos = 0
+    for m in RAW_BLOCK.finditer(src):
+        parts.append(_minify_markup(src[pos:m.start()]))
+        tag = m.group(2).lower()
+        body = m.group(3)
+        if tag == "script" and "src=" not in m.group(1):
+            body = "\n" + minify_js(body)
+        elif tag == "style":
+            body = minify_css(body)
+        parts.append(m.group(1) + body + m.group(4))
+        pos = m.end()
+    parts.append(_minify_markup(src[pos:]))
+    return "".join(parts)
+
+
+def _minify_markup(text):
+    text = re.sub(r"<!--(?!\[).*?-->", "", text, flags=re.S)
+    lines = (line.strip() for line in text.split("\n"))
+    return "\n".join(line for line in lines if line)
+
+
+def _node_accepts(js):
+    """node varsa küçültülmüş JS'yi sözdizimi kontrolünden geçir."""
+    node = shutil.which("node")
+    if node is None:
+        return True
+    with tempfile.NamedTemporaryFile("w", suffix=".js", delete=False, encoding="utf-8") as f:
+        f.write(js)
+        path = f.name
+    try:
+        return subprocess.run([node, "--check", path], capture_output=True).returncode == 0
+    finally:
+        os.unlink(path)
+
+
+def minify(rel, text):
+    if rel.endswith(".js"):
+        out = minify_js(text)
+        if not _node_accepts(out):
+            print(f"  ! {rel}: küçültülmüş JS sözdizimi hatalı, orijinal kullanılıyor")
+            return text
+        return out
+    if rel.endswith(".css"):
+        return minify_css(text)
+    if rel.endswith(".html"):
+        return minify_html(text)
+    return text
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()
+
+
+def version_references(html, versions):
+    """src="script.js" / href="style.css" -> ...?v=<hash>"""
+    def repl(m):
+        name = m.group(2)
+        if name not in versions:
+            return m.group(0)
+        return f'{m.group(1)}="{name}?v={versions[name]}"'
+    return re.sub(r'\b(src|href)="/?([\w./-]+\.(?:js|css))"', repl, html)
+
+
+def collect(src_dir):
+    files = []
+    for root, _, names in os.walk(src_dir):
+        for name in sorted(names):
+            path = os.path.join(root, name)
+            rel = os.path.relpath(path, src_dir).replace(os.sep, "/")
+            if rel == MANIFEST_NAME or rel.endswith(".gz"):
+                continue
+            files.append(rel)
+    # JS/CSS önce: HTML'e yazılacak sürümler onların hash'inden gelir.
+    # js/ alfabetik olarak script.js'den önce gelir: kabuğa yazılacak modül sürümleri hazır olur
+    return sorted(files, key=lambda r: (not r.endswith(VERSIONED_TYPES), r))
+
+
+def write_header(path, entries):
+    """Gömülü varlık tablosu: include/static_assets.h içindeki EmbeddedAsset dizisi."""
+    lines = [
+        "// Otomatik üretildi: tools/build_web_assets.py - elle düzenlemeyin",
+        "#ifndef WEB_ASSETS_DATA_H",
+        "#define WEB_ASSETS_DATA_H",
+        "",
+        '#include "static_assets.h"',
+        "",
+    ]
+    for i, (rel, packed, _) in enumerate(entries):
+        lines.append(f"// /{rel} ({len(packed)} B gzip)")
+        lines.append(f"static constexpr uint8_t webAsset{i}[] = {{")
+        for off in range(0, len(packed), 20):
+            lines.append("    " + ",".join(f"0x{b:02x}" for b in packed[off:off + 20]) + ",")
+        lines.append("};")
+        lines.append("")
+    lines.append(f"#define EMBEDDED_ASSET_COUNT {len(entries)}")
+    lines.append("")
+    lines.append("static constexpr EmbeddedAsset embeddedAssets[EMBEDDED_ASSET_COUNT] = {")
+    for i, (rel, packed, digest) in enumerate(entries):
+        lines.append(f'    {{"/{rel}", webAsset{i}, {len(packed)}, '
+                     f'"\\"{digest[:ETAG_HEX_LEN]}\\"", "{digest[:VERSION_HEX_LEN]}"}},')
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif // WEB_ASSETS_DATA_H")
+
+    os.makedirs(os.path.dirname(path) or ".", exist_ok=True)
+    content = "\n".join(lines) + "\n"
+    # İçerik aynıysa dosyaya dokunma: gereksiz yeniden derlemeyi önler
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == content:
+                return
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(content)
+
+
+def build(src_dir, out_dir, header_path=None):
+    if os.path.isdir(out_dir):
+        shutil.rmtree(out_dir)
+    os.makedirs(out_dir)
+
+    manifest = {"version": 1, "assets": {}}
+    versions = {}
+    module_versions = {}
+    embedded = []
+    total_src = total_gz = 0
+
+    for rel in collect(src_dir):
+        with open(os.path.join(src_dir, rel), "rb") as f:
+            raw = f.read()
+
+        data = raw
+        if rel.endswith(TEXT_TYPES):
+            text = raw.decode("utf-8")
+            if rel == SHELL_SCRIPT:
+                text = text.replace(MODULE_VERSIONS_MARKER,
+                                    json.dumps(module_versions, separators=(",", ":"), sort_keys=True))
+            text = minify(rel, text)
+            if rel.endswith(".html"):
+                text = version_references(text, versions)
+            data = text.encode("utf-8")
+
+        digest = content_hash(data)
+        if rel.endswith(VERSIONED_TYPES):
+            versions[rel] = digest[:VERSION_HEX_LEN]
+        if rel.startswith(PAGE_MODULE_DIR) and rel.endswith(".js"):
+            module_versions[rel[len(PAGE_MODULE_DIR):-3]] = digest[:VERSION_HEX_LEN]
+
+        # mtime=0: aynı girdi her derlemede aynı .gz'yi üretir
+        packed = gzip.compress(data, compresslevel=9, mtime=0)
+        out_path = os.path.join(out_dir, rel + ".gz")
+        os.makedirs(os.path.dirname(out_path), exist_ok=True)
+        with open(out_path, "wb") as f:
+            f.write(packed)
+
+        manifest["assets"]["/" + rel] = {
+            "etag": digest[:ETAG_HEX_LEN],
+            "version": digest[:VERSION_HEX_LEN],
+            "size": len(data),
+            "gzip": len(packed),
+        }
+        embedded.append((rel, packed, digest))
+        total_src += len(raw)
+        total_gz += len(packed)
+        print(f"  {rel:<28} {len(raw):>7} -> {len(data):>7} -> {len(packed):>6} B")
+
+    with open(os.path.join(out_dir, MANIFEST_NAME), "w", encoding="utf-8") as f:
+        json.dump(manifest, f, separators=(",", ":"), sort_keys=True)
+
+    if header_path is not None:
+        write_header(header_path, embedded)
+
+    print(f"web varlıkları: {len(manifest['assets'])} dosya, {total_src} -> {total_gz} B")
+    return manifest
+
+
+try:
+    Import("env")  # noqa: F821 - PlatformIO/SCons ortamında tanımlı
+except NameError:
+    env = None
+
+if env is not None:
+    _src = env.subst("$PROJECT_DATA_DIR")
+    _out = os.path.join(env.subst("$BUILD_DIR"), "www")
+    _gen = os.path.join(env.subst("$BUILD_DIR"), "generated")
+    print("Web varlıkları hazırlanıyor: %s -> %s" % (_src, _out))
+    build(_src, _out, os.path.join(_gen, HEADER_NAME))
+    env.Replace(PROJECT_DATA_DIR=_out)
+    env.Append(CPPPATH=[_gen])
+elif __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--src", default="data", help="kaynak dizin (varsayılan: data)")
+    parser.add_argument("--out", default=os.path.join(".pio", "www"), help="çıktı dizini")
+    parser.add_argument("--header", help=f"gömülü varlık başlığı ({HEADER_NAME}) yolu")
+    args = parser.parse_args()
+    if not os.path.isdir(args.src):
+        sys.exit(f"kaynak dizin yok: {args.src}")
+    build(args.src, args.out, args.header)
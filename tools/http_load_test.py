@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""/api/status gecikmesini toplu arıza aktarımı sırasında ve öncesinde ölçer.
+
+Aynı sayıda eşzamanlı /api/status sorgulayıcısı iki evrede çalışır:
+  1. temel   : yalnızca status sorguları
+  2. yüklü   : status sorguları + arka arkaya /api/faults/parsed?action=range aktarımı
+Her evre için p50/p95/p99/maks yazdırılır. Ertelenmiş yanıtlar doğru çalışıyorsa
+yüklü evrenin p99 değeri temel evreye yakın kalmalıdır (UART işi web task'ını tutmaz).
+
+Kullanım:
+    python3 tools/http_load_test.py --url http://192.168.1.160 --token <oturum>
+    python3 tools/http_load_test.py --url http://192.168.1.160 --user admin --password ... \\
+        --clients 4 --duration 30 --faults 100
+
+Not: --user ile giriş ayrı bir oturum açar; tarayıcıdaki oturum açık kalır.
+"""
+
+import argparse
+import http.client
+import json
+import threading
+import time
+import urllib.parse
+
+
+def parse_url(url):
+    parts = urllib.parse.urlsplit(url)
+    return parts.hostname, parts.port or 80
+
+
+def request(host, port, method, path, token=None, body=None, timeout=30):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    headers = {}
+    if token:
+        headers["Authorization"] = "Bearer " + token
+    if body is not None:
+        body = urllib.parse.urlencode(body)
+        headers["Content-Type"] = "application/x-www-form-urlencoded"
+    try:
+        conn.request(method, path, body=body, headers=headers)
+        response = conn.getresponse()
+        data = response.read()
+        return response.status, data
+    finally:
+        conn.close()
+
+
+def login(host, port, user, password):
+    status, data = request(host, port, "POST", "/login", body={"username": user, "password": password})
+    if status != 200:
+        raise SystemExit("giriş başarısız: HTTP %d %s" % (status, data[:200]))
+    return json.loads(data)["token"]
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    k = min(len(values) - 1, int(round(p / 100.0 * (len(values) - 1))))
+    return values[k]
+
+
+def status_poller(host, port, token, stop, latencies, errors, interval):
+    while not stop.is_set():
+        start = time.perf_counter()
+        try:
+            status, _ = request(host, port, "GET", "/api/status", token, timeout=10)
+            if status == 200:
+                latencies.append((time.perf_counter() - start) * 1000.0)
+            else:
+                errors.append(status)
+        except Exception as exc:  # bağlantı hatası da sonuçtur
+            errors.append(type(exc).__name__)
+        if interval > 0:
+            stop.wait(interval)
+
+
+def bulk_fetch(host, port, token, stop, total_faults, stats):
+    """Arızaları 20'lik aralıklarla, durdurulana kadar tekrar tekrar çeker."""
+    while not stop.is_set():
+        for first in range(1, total_faults + 1, 20):
+            if stop.is_set():
+                return
+            last = min(first + 19, total_faults)
+            start = time.perf_counter()
+            try:
+                status, data = request(host, port, "POST", "/api/faults/parsed", token,
+                                       body={"action": "range", "from": first, "to": last}, timeout=90)
+                stats["requests"] += 1
+                stats["ms"].append((time.perf_counter() - start) * 1000.0)
+                if status == 200:
+                    stats["records"] += json.loads(data).get("received", 0)
+                else:
+                    stats["errors"] += 1
+            except Exception:
+                stats["errors"] += 1
+
+
+def run_phase(name, host, port, token, clients, duration, interval, bulk_faults=0):
+    stop = threading.Event()
+    latencies, errors = [], []
+    threads = [threading.Thread(target=status_poller,
+                                args=(host, port, token, stop, latencies, errors, interval))
+               for _ in range(clients)]
+    bulk_stats = {"requests": 0, "records": 0, "errors": 0, "ms": []}
+    if bulk_faults:
+        threads.append(threading.Thread(target=bulk_fetch,
+                                        args=(host, port, token, stop, bulk_faults, bulk_stats)))
+
+    for t in threads:
+        t.start()
+    time.sleep(duration)
+    stop.set()
+    for t in threads:
+        t.join()
+
+    print("%-7s istek %5d  hata %3d  p50 %7.1f  p95 %7.1f  p99 %7.1f  maks %7.1f ms" % (
+        name, len(latencies), len(errors), percentile(latencies, 50), percentile(latencies, 95),
+        percentile(latencies, 99), max(latencies) if latencies else 0.0))
+    if bulk_faults:
+        print("        toplu aktarım: %d istek, %d kayıt, %d hata, ort. %.0f ms/istek" % (
+            bulk_stats["requests"], bulk_stats["records"], bulk_stats["errors"],
+            sum(bulk_stats["ms"]) / len(bulk_stats["ms"]) if bulk_stats["ms"] else 0.0))
+    return percentile(latencies, 99)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--url", required=True, help="Cihaz adresi, ör. http://192.168.1.160")
+    parser.add_argument("--token", help="Oturum jetonu")
+    parser.add_argument("--user", help="Jeton yoksa giriş için kullanıcı adı")
+    parser.add_argument("--password", help="Jeton yoksa giriş için parola")
+    parser.add_argument("--clients", type=int, default=4, help="Eşzamanlı status sorgulayıcı sayısı")
+    parser.add_argument("--duration", type=float, default=20.0, help="Evre başına süre (s)")
+    parser.add_argument("--interval", type=float, default=0.2, help="Sorgulayıcı başına istek aralığı (s)")
+    parser.add_argument("--faults", type=int, default=100, help="Toplu aktarımda çekilecek arıza sayısı")
+    args = parser.parse_args()
+
+    host, port = parse_url(args.url)
+    token = args.token
+    if not token:
+        if not (args.user and args.password):
+            parser.error("--token ya da --user/--password gerekli")
+        token = login(host, port, args.user, args.password)
+
+    base = run_phase("temel", host, port, token, args.clients, args.duration, args.interval)
+    loaded = run_phase("yüklü", host, port, token, args.clients, args.duration, args.interval, args.faults)
+
+    if base > 0:
+        print("p99 oranı (yüklü / temel): %.2f" % (loaded / base))
+
+
+if __name__ == "__main__":
+    main()
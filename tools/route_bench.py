@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Özetli rota tablosu ile WebServer'ın doğrusal eşleştirmesini karşılaştırır.
+
+İki kip:
+  cihaz    : GET /api/metrics/routes?bench=N - cihaz tüm rotaları hem özetli indeksle
+             hem de WebServer gibi handler listesini dolaşarak arar, çevrim sayılarını döner
+  --offline: src/web_routes.cpp içindeki ROUTE(...) satırlarını okur, firmware ile aynı
+             FNV-1a anahtarlarını hesaplar ve indeks yerleşimini (çakışma, en uzun arama
+             zinciri) raporlar; cihaz gerekmez
+
+Kullanım:
+    python3 tools/route_bench.py --url http://192.168.1.160 --token <oturum> [--rounds 200]
+    python3 tools/route_bench.py --offline [--source src/web_routes.cpp]
+"""
+
+import argparse
+import http.client
+import json
+import re
+import urllib.parse
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+INDEX_SLOTS = 128  # include/route_table.h: ROUTE_INDEX_SLOTS
+
+# arduino-esp32 2.0.x HTTPMethod = http_parser enum http_method
+METHODS = {"HTTP_DELETE": 0, "HTTP_GET": 1, "HTTP_HEAD": 2, "HTTP_POST": 3,
+           "HTTP_PUT": 4, "HTTP_OPTIONS": 6, "HTTP_PATCH": 28}
+
+# ROUTE(...), ROUTE_STATIC(...), ROUTE_UART(...); ROUTE_ENTRY/ROUTE_HEAVY'de metottan önce
+# sınıf, bayrak ve heap tahmini gelir
+ROUTE_RE = re.compile(r'\bROUTE(?:_[A-Z]+)?\((?:[^"()]*?,\s*)?(HTTP_\w+),\s*"([^"]*)"')
+
+
+def route_key(method, path):
+    """include/route_table.h routeKey() ile aynı."""
+    h = ((FNV_OFFSET ^ METHODS[method]) * FNV_PRIME) & 0xFFFFFFFF
+    for b in path.encode("utf-8"):
+        h = ((h ^ b) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def offline(source):
+    with open(source, encoding="utf-8") as f:
+        routes = ROUTE_RE.findall(f.read())
+    if not routes:
+        raise SystemExit("ROUTE(...) bulunamadı: %s" % source)
+
+    slots = [None] * INDEX_SLOTS
+    probes = []
+    keys = {}
+    for method, path in routes:
+        key = route_key(method, path)
+        if key in keys:
+            print("  ! özet çakışması: %s %s ~ %s" % (method, path, keys[key]))
+        keys[key] = "%s %s" % (method, path)
+        slot = key & (INDEX_SLOTS - 1)
+        probe = 0
+        while slots[slot] is not None:
+            slot = (slot + 1) & (INDEX_SLOTS - 1)
+            probe += 1
+        slots[slot] = (method, path)
+        probes.append(probe)
+
+    n = len(routes)
+    print("rota: %d  indeks: %d yuva (doluluk %%%d)" % (n, INDEX_SLOTS, 100 * n // INDEX_SLOTS))
+    print("arama zinciri: ort. %.2f  en uzun %d" % (1 + sum(probes) / float(n), 1 + max(probes)))
+    # WebServer listesi kayıt sırasıyla dolaşılır: i. rota i+1 karşılaştırma
+    print("doğrusal liste: ort. %.1f  en kötü %d karşılaştırma" % ((n + 1) / 2.0, n))
+
+
+def device(url, token, rounds):
+    parts = urllib.parse.urlsplit(url)
+    conn = http.client.HTTPConnection(parts.hostname, parts.port or 80, timeout=60)
+    try:
+        conn.request("GET", "/api/metrics/routes?bench=%d" % rounds,
+                     headers={"Authorization": "Bearer " + token})
+        response = conn.getresponse()
+        data = response.read()
+    finally:
+        conn.close()
+    if response.status != 200:
+        raise SystemExit("HTTP %d %s" % (response.status, data[:200]))
+
+    metrics = json.loads(data)
+    bench = metrics["bench"]
+    mhz = float(bench["cpuMhz"])
+    print("rota: %d  tur: %d  CPU: %d MHz  en uzun zincir: %d" % (
+        bench["routes"], bench["rounds"], mhz, metrics["maxProbe"] + 1))
+    for name, cycles in (("özetli", bench["hashedAvgCycles"]),
+                         ("doğrusal ort.", bench["linearAvgCycles"]),
+                         ("doğrusal en kötü", bench["linearWorstCycles"])):
+        print("  %-17s %7d çevrim  %8.2f µs" % (name, cycles, cycles / mhz))
+    if bench["hashedAvgCycles"] > 0:
+        print("hızlanma (ort.): %.1fx" % (bench["linearAvgCycles"] / float(bench["hashedAvgCycles"])))
+    print("canlı trafik: tablo %d, önek %d, liste %d istek, arama ort. %d ns" % (
+        metrics["exact"], metrics["prefixed"], metrics["fallback"], metrics["lookupAvgNs"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--url", help="Cihaz adresi, ör. http://192.168.1.160")
+    parser.add_argument("--token", help="Oturum jetonu")
+    parser.add_argument("--rounds", type=int, default=200, help="Tur sayısı (en fazla 1000)")
+    parser.add_argument("--offline", action="store_true", help="Cihaz olmadan indeks yerleşimini raporla")
+    parser.add_argument("--source", default="src/web_routes.cpp", help="--offline için rota kaynağı")
+    args = parser.parse_args()
+
+    if args.offline:
+        offline(args.source)
+    elif args.url and args.token:
+        device(args.url, args.token, args.rounds)
+    else:
+        parser.error("--offline ya da --url/--token gerekli")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Cihazın HTTP yanıtlarının kaç TCP veri segmentiyle gittiğini bir pcap kaydından sayar.
+
+Yanıt başına segment sayısı yolla (ör. /api/status) gruplanır; başlık ve gövdenin ayrı
+segmentlerde gitmesi, istemci gecikmeli ACK'i ile bir tur beklemeye dönüşebilir.
+Firmware tarafındaki karşılığı /api/metrics/http -> endpoints.routes[].writesPerResponse.
+
+Kayıt (cihazla aynı ağdaki bir makinede):
+    sudo tcpdump -i wlan0 -w status.pcap host 192.168.1.160 and tcp port 80
+    (bu sırada panel açık kalır ya da tools/http_load_test.py çalıştırılır)
+
+Kullanım:
+    python3 tools/segment_count.py status.pcap --device 192.168.1.160 [--path /api/status]
+"""
+
+import argparse
+import collections
+import socket
+import struct
+
+LINKTYPE_ETHERNET = 1
+LINKTYPE_RAW = 101
+LINKTYPE_LINUX_SLL = 113
+
+
+def packets(path):
+    """pcap (libpcap, mikro/nanosaniye) kaydındaki IPv4 paketlerini döner."""
+    with open(path, "rb") as f:
+        header = f.read(24)
+        magic = header[:4]
+        if magic in (b"\xd4\xc3\xb2\xa1", b"\x4d\x3c\xb2\xa1"):
+            endian = "<"
+        elif magic in (b"\xa1\xb2\xc3\xd4", b"\xa1\xb2\x3c\x4d"):
+            endian = ">"
+        else:
+            raise SystemExit("pcap değil (pcapng ise: tcpdump -w ile kaydedin): %s" % path)
+        linktype = struct.unpack(endian + "I", header[20:24])[0]
+
+        while True:
+            record = f.read(16)
+            if len(record) < 16:
+                return
+            caplen = struct.unpack(endian + "IIII", record)[2]
+            frame = f.read(caplen)
+            if linktype == LINKTYPE_ETHERNET:
+                offset, ethertype = 14, frame[12:14]
+                if ethertype == b"\x81\x00":          # VLAN etiketi
+                    offset, ethertype = 18, frame[16:18]
+                if ethertype != b"\x08\x00":
+                    continue
+            elif linktype == LINKTYPE_LINUX_SLL:
+                offset = 16
+                if frame[14:16] != b"\x08\x00":
+                    continue
+            elif linktype == LINKTYPE_RAW:
+                offset = 0
+            else:
+                raise SystemExit("desteklenmeyen bağlantı tipi: %d" % linktype)
+            yield frame[offset:]
+
+
+def tcp_segments(path):
+    """(kaynak, hedef, veri) üçlüleri - yalnızca veri taşıyan TCP segmentleri."""
+    for ip in packets(path):
+        if len(ip) < 20 or ip[0] >> 4 != 4 or ip[9] != 6:
+            continue
+        ihl = (ip[0] & 0x0F) * 4
+        total = struct.unpack(">H", ip[2:4])[0]
+        tcp = ip[ihl:total]
+        if len(tcp) < 20:
+            continue
+        sport, dport = struct.unpack(">HH", tcp[:4])
+        payload = tcp[(tcp[12] >> 4) * 4:]
+        if payload:
+            src = (socket.inet_ntoa(ip[12:16]), sport)
+            dst = (socket.inet_ntoa(ip[16:20]), dport)
+            yield src, dst, payload
+
+
+def count(path, device, port, only_path):
+    pending = collections.defaultdict(collections.deque)   # istemci -> yanıt bekleyen yollar
+    current = {}                                            # istemci -> [yol, segment, bayt]
+    results = collections.defaultdict(list)
+
+    def close(client):
+        entry = current.pop(client, None)
+        if entry is not None:
+            results[entry[0]].append((entry[1], entry[2]))
+
+    for src, dst, payload in tcp_segments(path):
+        if dst == (device, port):
+            # İstek satırı: "GET /api/status?x=1 HTTP/1.1"
+            line = payload.split(b"\r\n", 1)[0].split(b" ")
+            if len(line) == 3 and line[2].startswith(b"HTTP/1."):
+                pending[src].append(line[1].split(b"?", 1)[0].decode("latin-1"))
+        elif src == (device, port):
+            if payload.startswith(b"HTTP/1."):
+                close(dst)
+                queue = pending[dst]
+                current[dst] = [queue.popleft() if queue else "?", 0, 0]
+            entry = current.get(dst)
+            if entry is not None:
+                entry[1] += 1
+                entry[2] += len(payload)
+    for client in list(current):
+        close(client)
+
+    if not results:
+        raise SystemExit("kayıtta %s:%d yanıtı yok" % (device, port))
+    print("%-32s %6s %8s %6s %9s" % ("yol", "yanıt", "seg/ort", "en çok", "bayt/ort"))
+    for name in sorted(results):
+        if only_path and name != only_path:
+            continue
+        items = results[name]
+        segments = [s for s, _ in items]
+        print("%-32s %6d %8.2f %6d %9d" % (name, len(items), sum(segments) / float(len(items)),
+                                           max(segments), sum(b for _, b in items) // len(items)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("pcap", help="tcpdump -w ile alınmış kayıt")
+    parser.add_argument("--device", required=True, help="Cihaz IP adresi")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--path", help="Yalnızca bu yolu raporla, ör. /api/status")
+    args = parser.parse_args()
+    count(args.pcap, args.device, args.port, args.path)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""UART kayıt dosyasını (uart_capture.bin) çözümler ve ayrıştırıcılardan geçirir.
+
+Kayıt cihazdan /api/uart/capture/download ile indirilir. Biçim
+include/uart_capture.h içinde tanımlıdır. Araç her TX komutunu sonraki RX
+yanıtıyla eşler ve yanıtı firmware ile aynı kurallarla çözer. Bunlar
+getTotalFaultCount (AN), parseeDateTimeResponse (DN) ve parseFaultData
+(NNNNNv) kurallarıdır.
+
+Kullanım:
+    python3 tools/uart_replay.py uart_capture.bin
+    python3 tools/uart_replay.py uart_capture.bin --summary
+    python3 tools/uart_replay.py --url http://192.168.1.160 --token <oturum> -o uart_capture.bin
+
+İndirme koparsa Range + If-Range ile kaldığı yerden devam edilir; kayıt bu arada
+değiştiyse cihaz tam dosyayı yeniden gönderir.
+"""
+
+import argparse
+import http.client
+import struct
+import sys
+import urllib.request
+
+FILE_HEADER = struct.Struct("<4sBBHII")
+RECORD_HEADER = struct.Struct("<IHBB")
+
+FLAG_RX = 0x01
+FLAG_TIMEOUT = 0x02
+FLAG_TRUNCATED = 0x04
+
+
+def read_capture(data):
+    magic, version, _, header_size, record_count, dropped = FILE_HEADER.unpack_from(data, 0)
+    if magic != b"T43U":
+        raise ValueError("geçersiz dosya imzası: %r" % magic)
+    if version != 1:
+        raise ValueError("desteklenmeyen sürüm: %d" % version)
+
+    records = []
+    offset = header_size
+    while offset + RECORD_HEADER.size <= len(data):
+        ts, seq, flags, length = RECORD_HEADER.unpack_from(data, offset)
+        offset += RECORD_HEADER.size
+        payload = data[offset:offset + length].decode("latin-1")
+        offset += length
+        records.append({"ts": ts, "seq": seq, "flags": flags, "payload": payload})
+
+    if len(records) != record_count:
+        print("uyarı: başlık %d kayıt diyor, %d okundu" % (record_count, len(records)), file=sys.stderr)
+    return records, dropped
+
+
+def unwrap_timestamps(records):
+    """micros() 32 bitte ~71 dakikada taşar; zamanı sürekli hale getir."""
+    base = 0
+    prev = None
+    for r in records:
+        if prev is not None and r["ts"] < prev:
+            base += 1 << 32
+        prev = r["ts"]
+        r["t"] = base + r["ts"]
+
+
+# --- firmware ayrıştırıcılarının karşılıkları ---
+
+def parse_fault_count(resp):
+    if len(resp) >= 2 and resp[0] == "A":
+        digits = ""
+        for c in resp[1:]:
+            if not c.isdigit():
+                break
+            digits += c
+        count = int(digits or "0") - 1
+        if count >= 0:
+            return {"faultCount": count}
+    return None
+
+
+def parse_datetime(resp):
+    if len(resp) < 10 or not resp.startswith("D:"):
+        return None
+    rest = resp[2:].strip()
+    space = rest.find(" ")
+    if space <= 0 or space >= len(rest) - 1:
+        return None
+    date, time = rest[:space], rest[space + 1:]
+    if len(date) == 8 and date[2] == "/" and date[5] == "/" and \
+            len(time) == 8 and time[2] == ":" and time[5] == ":":
+        return {"date": date, "time": time}
+    return None
+
+
+HEX = set("0123456789abcdefABCDEF")
+
+
+def hex_to_int(text):
+    # Firmware'deki parseHexToInt/hexCharToInt gibi: geçersiz hane 0 sayılır
+    value = 0
+    for ch in text:
+        value = value * 16 + (int(ch, 16) if ch in HEX else 0)
+    return value
+
+
+def parse_fault(resp):
+    data = resp.strip()
+    if len(data) < 16 or data[0] not in HEX or data[1] not in HEX:
+        return None
+    if not data[2:14].isdigit():
+        return None
+
+    pin = int(data[0:2], 16)
+    year, month, day, hour, minute, second = (int(data[i:i + 2]) for i in range(2, 14, 2))
+    if not (1 <= month <= 12 and 1 <= day <= 31 and hour <= 23 and minute <= 59 and second <= 59):
+        return None
+
+    fault = {
+        "pin": pin,
+        "pinType": "Çıkış" if 1 <= pin <= 8 else "Giriş" if 9 <= pin <= 16 else "Bilinmeyen",
+        "dateTime": "%02d/%02d/%04d %02d:%02d:%02d" % (day, month, 2000 + year, hour, minute, second),
+    }
+    if len(data) >= 20:
+        fault["millisecond"] = hex_to_int(data[14:17])
+        duration = data[17:22]
+        if len(duration) == 5:
+            fault["duration"] = hex_to_int(duration[0:2]) + hex_to_int(duration[2:5]) / 4096.0
+    return fault
+
+
+def decode(command, response):
+    if command == "AN":
+        return parse_fault_count(response)
+    if command == "DN":
+        return parse_datetime(response)
+    if len(command) == 6 and command.endswith("v") and command[:5].isdigit():
+        return parse_fault(response)
+    return None
+
+
+def replay(records, summary_only):
+    unwrap_timestamps(records)
+    start = records[0]["t"] if records else 0
+
+    pending = None
+    latencies = {}
+    timeouts = {}
+    parse_failures = {}
+    prev_gap_end = None
+    gaps = []
+
+    for r in records:
+        rel_ms = (r["t"] - start) / 1000.0
+        rx = r["flags"] & FLAG_RX
+
+        if not rx:
+            if prev_gap_end is not None:
+                gaps.append((r["t"] - prev_gap_end) / 1000.0)
+            pending = r
+            if not summary_only:
+                print("%10.3f  TX  #%-5d %s" % (rel_ms, r["seq"], r["payload"]))
+            continue
+
+        prev_gap_end = r["t"]
+        command = pending["payload"] if pending else "?"
+        kind = command[-1:] if command not in ("AN", "DN") else command
+        latency = (r["t"] - pending["t"]) / 1000.0 if pending else 0.0
+        pending = None
+
+        if r["flags"] & FLAG_TIMEOUT:
+            timeouts[kind] = timeouts.get(kind, 0) + 1
+            if not summary_only:
+                print("%10.3f  RX  #%-5d (zaman aşımı, %.1f ms)" % (rel_ms, r["seq"], latency))
+            continue
+
+        latencies.setdefault(kind, []).append(latency)
+        decoded = decode(command, r["payload"])
+        if decoded is None and (command in ("AN", "DN") or command.endswith("v")):
+            parse_failures[kind] = parse_failures.get(kind, 0) + 1
+
+        if not summary_only:
+            flag = " [kesildi]" if r["flags"] & FLAG_TRUNCATED else ""
+            print("%10.3f  RX  #%-5d %s  (%.1f ms)%s" % (rel_ms, r["seq"], r["payload"], latency, flag))
+            if decoded is not None:
+                print("%18s-> %s" % ("", decoded))
+
+    print()
+    print("Komut  adet  ort.ms  maks.ms  zaman-aşımı  çözülemeyen")
+    for kind in sorted(set(latencies) | set(timeouts)):
+        values = latencies.get(kind, [])
+        avg = sum(values) / len(values) if values else 0.0
+        worst = max(values) if values else 0.0
+        print("%-5s %5d %7.1f %8.1f %12d %12d" % (kind, len(values), avg, worst,
+                                                  timeouts.get(kind, 0), parse_failures.get(kind, 0)))
+    if gaps:
+        gaps.sort()
+        print("Komutlar arası boşluk: min %.1f ms, medyan %.1f ms" % (gaps[0], gaps[len(gaps) // 2]))
+
+
+def download(url, token, path, attempts=5):
+    data = b""
+    etag = None
+    for attempt in range(attempts):
+        headers = {"Authorization": "Bearer " + token}
+        if data and etag:
+            headers["Range"] = "bytes=%d-" % len(data)
+            headers["If-Range"] = etag
+        request = urllib.request.Request(url.rstrip("/") + "/api/uart/capture/download", headers=headers)
+        try:
+            with urllib.request.urlopen(request, timeout=30) as response:
+                if response.status != 206:
+                    data = b""   # İlk istek ya da kayıt değişti: tam gövde
+                etag = response.headers.get("ETag")
+                while True:
+                    block = response.read(4096)
+                    if not block:
+                        break
+                    data += block
+            break
+        except (OSError, http.client.HTTPException) as e:
+            if attempt == attempts - 1:
+                raise SystemExit("indirme başarısız (%d bayt alındı): %s" % (len(data), e))
+            print("bağlantı koptu (%d bayt), devam ediliyor: %s" % (len(data), e))
+    with open(path, "wb") as f:
+        f.write(data)
+    print("%d bayt indirildi: %s" % (len(data), path))
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", nargs="?", help="uart_capture.bin")
+    parser.add_argument("--url", help="Cihaz adresi; verilirse kayıt önce indirilir")
+    parser.add_argument("--token", help="Oturum jetonu (--url ile)")
+    parser.add_argument("-o", "--output", default="uart_capture.bin", help="İndirilen dosyanın adı")
+    parser.add_argument("--summary", action="store_true", help="Yalnızca özet tabloyu yazdır")
+    args = parser.parse_args()
+
+    if args.url:
+        if not args.token:
+            parser.error("--url için --token gerekli")
+        data = download(args.url, args.token, args.output)
+    elif args.file:
+        with open(args.file, "rb") as f:
+            data = f.read()
+    else:
+        parser.error("dosya ya da --url verin")
+
+    records, dropped = read_capture(data)
+    print("%d kayıt (%d eski kayıt tampon dolduğu için düşmüş)" % (len(records), dropped))
+    replay(records, args.summary)
+
+
+if __name__ == "__main__":
+    main()